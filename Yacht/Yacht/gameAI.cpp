@@ -1,5 +1,13 @@
 #include "gameAI.h"
 #include "gameLogic.h"
+#include "gameReplay.h"
+#include "gameCache.h"
+#include "gameTrace.h"
+#include "gameRules.h"
+#include "gameWinProb.h"
+#include "gameMcts.h"
+#include "gameBot.h"
+#include "gameEndgame.h"
 
 Category chooseBestScoringCategory_Easy(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used) {
     int maxScore = -1;
@@ -13,7 +21,9 @@ Category chooseBestScoringCategory_Easy(const Dice& d, const array<bool, static_
     return bestCat;
 }
 
-pair<Category, int> findBestExpectedCategory_Normal(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft) {
+// Ģ   ǥ  ü ( б  å Ŀη )
+template <class R>
+static pair<Category, int> expectedCategoryImpl(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft) {
     int maxExpectedScore = -1;
     Category bestCategory = Category::CATEGORY_COUNT;
     for (int i = 0; i < static_cast<int>(Category::CATEGORY_COUNT); ++i) {
@@ -38,7 +48,7 @@ pair<Category, int> findBestExpectedCategory_Normal(const Dice& d, const array<b
             }
             for (int r = 0; r < rollsLeft; ++r)
                 for (int j = 0; j < 5; ++j) if (!tempHeld[j]) tempDice[j] = roll6();
-            sumScores += scoreCategory(static_cast<Category>(i), tempDice);
+            sumScores += rules::Kernel<R>::score(static_cast<Category>(i), tempDice.data());
         }
         int expectedScore = static_cast<int>(sumScores / SIMULATIONS);
         if (expectedScore > maxExpectedScore) { maxExpectedScore = expectedScore; bestCategory = static_cast<Category>(i); }
@@ -46,8 +56,106 @@ pair<Category, int> findBestExpectedCategory_Normal(const Dice& d, const array<b
     return make_pair(bestCategory, maxExpectedScore);
 }
 
+pair<Category, int> findBestExpectedCategory_Normal(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft) {
+    TRACE_SCOPE("ai.expectedCategory", "ai");
+    return rules::withRules(rulesVariant(), [&](auto r) { return expectedCategoryImpl<decltype(r)>(d, used, rollsLeft); });
+}
+
+// ===================  ĳ ===================
+//  (ĵ ֻ,  īװ,  ) Ȳ ϰ  Ѿ  ݺǹǷ
+// / AI   Ѵ.   ùķ̼ 尡 Բ Ƿ 庰  ĳ .
+// Ȧ  ī ̶ ó   ĳÿ  ִ  ȴ.
+static DecisionCache g_decisionCache(1 << 18, 16);
+static atomic<bool> g_decisionCacheEnabled{ true };
+static atomic<uint64_t> g_decisionsUncached{ 0 };
+static atomic<uint8_t> g_decisionCacheRules{ static_cast<uint8_t>(RulesVariant::YAHTZEE) };
+
+enum DecisionKind : uint32_t { DECISION_HOLD = 1, DECISION_CATEGORY = 2 };
+
+// [ 2Ʈ][  2Ʈ][ ũ 13Ʈ][ĵ ֻ 5 x 3Ʈ]
+static uint32_t decisionKey(DecisionKind kind, const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft) {
+    Dice sorted = d;
+    sort(sorted.begin(), sorted.end());
+    uint32_t key = static_cast<uint32_t>(kind) << 30 | static_cast<uint32_t>(rollsLeft & 3) << 28;
+    for (int i = 0; i < static_cast<int>(Category::CATEGORY_COUNT); ++i) if (used[i]) key |= 1u << (15 + i);
+    for (int i = 0; i < 5; ++i) key |= static_cast<uint32_t>(sorted[i]) << (i * 3);
+    return key;
+}
+
+// Ȧ ġ ƴ϶ "   " ؾ  ֻ ٸ    ִ
+static uint32_t encodeHold(const Dice& d, const array<bool, 5>& held) {
+    uint32_t v = 0;
+    for (int i = 0; i < 5; ++i) if (held[i]) v += 1u << ((d[i] - 1) * 3);
+    return v;
+}
+static array<bool, 5> decodeHold(const Dice& d, uint32_t v) {
+    array<bool, 5> held{};
+    for (int i = 0; i < 5; ++i) {
+        uint32_t shift = (d[i] - 1) * 3;
+        if ((v >> shift) & 7) { held[i] = true; v -= 1u << shift; }
+    }
+    return held;
+}
+
+// Ű Ģ Ƿ (Ʈ īε ̸  óǾ   ũ ģ) Ģ ٲ 
+static void syncDecisionCacheRules() {
+    const uint8_t now = static_cast<uint8_t>(rulesVariant());
+    uint8_t prev = g_decisionCacheRules.load(memory_order_relaxed);
+    if (prev != now && g_decisionCacheRules.compare_exchange_strong(prev, now)) g_decisionCache.clear();
+}
+
+void setDecisionCacheEnabled(bool enabled) { g_decisionCacheEnabled.store(enabled, memory_order_relaxed); }
+bool decisionCacheEnabled() { return g_decisionCacheEnabled.load(memory_order_relaxed); }
+void resetDecisionCache() {
+    g_decisionCache.clear();
+    g_decisionsUncached.store(0, memory_order_relaxed);
+}
+DecisionCacheStats decisionCacheStats() {
+    CacheStats st = g_decisionCache.stats();
+    DecisionCacheStats out;
+    out.hits = st.hits;
+    out.misses = st.misses;
+    out.evictions = st.evictions;
+    out.uncached = g_decisionsUncached.load(memory_order_relaxed);
+    out.entries = st.entries;
+    out.capacity = st.capacity;
+    return out;
+}
+
+static array<bool, 5> computeHold_Hard(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft);
+static Category computeScoringCategory(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used);
+
 array<bool, 5> chooseBestHoldStrategy_Hard(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft, int /*round*/) {
+    TRACE_SCOPE("ai.chooseHold", "ai");
     if (rollsLeft == 0) return { true, true, true, true, true };
+    if (!decisionCacheEnabled()) {
+        g_decisionsUncached.fetch_add(1, memory_order_relaxed);
+        return computeHold_Hard(d, used, rollsLeft);
+    }
+    syncDecisionCacheRules();
+    uint32_t key = decisionKey(DECISION_HOLD, d, used, rollsLeft), value;
+    if (g_decisionCache.lookup(key, value)) return decodeHold(d, value);
+    array<bool, 5> held = computeHold_Hard(d, used, rollsLeft);
+    g_decisionCache.insert(key, encodeHold(d, held));
+    return held;
+}
+
+Category chooseBestScoringCategory(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int /*round*/, AIDifficulty difficulty) {
+    TRACE_SCOPE("ai.chooseCategory", "ai");
+    if (difficulty == AIDifficulty::EASY) return chooseBestScoringCategory_Easy(d, used);
+    if (!decisionCacheEnabled()) {
+        g_decisionsUncached.fetch_add(1, memory_order_relaxed);
+        return computeScoringCategory(d, used);
+    }
+    syncDecisionCacheRules();
+    uint32_t key = decisionKey(DECISION_CATEGORY, d, used, 0), value;
+    if (g_decisionCache.lookup(key, value)) return static_cast<Category>(value);
+    Category cat = computeScoringCategory(d, used);
+    g_decisionCache.insert(key, static_cast<uint32_t>(cat));
+    return cat;
+}
+
+static array<bool, 5> computeHold_Hard(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft) {
     if (!used[static_cast<int>(Category::YAHTZEE)] && scoreYahtzee(d) > 0) return { true, true, true, true, true };
     if (!used[static_cast<int>(Category::LARGE_STRAIGHT)] && scoreLargeStraight(d) > 0) return { true, true, true, true, true };
     if (!used[static_cast<int>(Category::FULL_HOUSE)] && scoreFullHouse(d) > 0) return { true, true, true, true, true };
@@ -87,12 +195,13 @@ array<bool, 5> chooseBestHoldStrategy_Hard(const Dice& d, const array<bool, stat
         break;
     }
     case Category::SMALL_STRAIGHT: case Category::LARGE_STRAIGHT: {
-        set<int> uniqueDice;
+        //  ó  ֻ ϳ (  Ʈũ )
+        int seen = 0;
         array<bool, 5> heldForStraight{};
-        for (int val : d) {
-            if (uniqueDice.insert(val).second) {
-                for (int i = 0; i < 5; ++i) if (d[i] == val && !heldForStraight[i]) { heldForStraight[i] = true; break; }
-            }
+        for (int i = 0; i < 5; ++i) {
+            if (seen >> d[i] & 1) continue;
+            seen |= 1 << d[i];
+            heldForStraight[i] = true;
         }
         return heldForStraight;
     }
@@ -104,8 +213,7 @@ array<bool, 5> chooseBestHoldStrategy_Hard(const Dice& d, const array<bool, stat
     return bestHeld;
 }
 
-Category chooseBestScoringCategory(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int /*round*/, AIDifficulty difficulty) {
-    if (difficulty == AIDifficulty::EASY) return chooseBestScoringCategory_Easy(d, used);
+static Category computeScoringCategory(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used) {
     int maxScore = -1; Category bestCat = Category::CATEGORY_COUNT;
     if (!used[static_cast<int>(Category::YAHTZEE)] && scoreYahtzee(d) > 0) return Category::YAHTZEE;
     if (!used[static_cast<int>(Category::LARGE_STRAIGHT)] && scoreLargeStraight(d) > 0) return Category::LARGE_STRAIGHT;
@@ -120,4 +228,50 @@ Category chooseBestScoringCategory(const Dice& d, const array<bool, static_cast<
         if (!used[static_cast<int>(Category::CHANCE)] && sumDice(d) < 10) return Category::CHANCE;
     }
     return bestCat;
+}
+
+string_view difficultyName(AIDifficulty difficulty) {
+    static const string_view NAMES[] = { u8"", u8"", u8"", u8"ºλ", u8"Ž", u8"ܺ " };
+    const int i = static_cast<int>(difficulty);
+    return (i >= 0 && i < 6) ? NAMES[i] : u8"?";
+}
+
+array<bool, 5> chooseHold(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int rollsLeft, int round, AIDifficulty difficulty) {
+    if (difficulty == AIDifficulty::MCTS && !endgameApplies(self)) return chooseHold_Mcts(d, self, rollsLeft);
+    if (difficulty == AIDifficulty::EXTERNAL && externalBot()) return chooseHold_Bot(d, self, table, rollsLeft, round);
+    if (difficulty == AIDifficulty::WINPROB && table && winProbApplies(self, *table)) return chooseHold_WinProb(d, self, *table, rollsLeft);
+    if (difficulty != AIDifficulty::EASY && endgameApplies(self)) return chooseHold_Endgame(d, self, rollsLeft);
+    return chooseBestHoldStrategy_Hard(d, self.used, rollsLeft, round);
+}
+
+Category chooseCategory(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int round, AIDifficulty difficulty) {
+    if (difficulty == AIDifficulty::MCTS && !endgameApplies(self)) return chooseCategory_Mcts(d, self);
+    if (difficulty == AIDifficulty::EXTERNAL && externalBot()) return chooseCategory_Bot(d, self, table, round);
+    if (difficulty == AIDifficulty::WINPROB && table && winProbApplies(self, *table)) return chooseCategory_WinProb(d, self, *table);
+    if (difficulty != AIDifficulty::EASY && endgameApplies(self)) return chooseCategory_Endgame(d, self);
+    return chooseBestScoringCategory(d, self.used, round, difficulty);
+}
+
+Category playAITurn(Scorecard& sc, Dice& dice, int round, AIDifficulty difficulty, ReplayRecorder* rec, const vector<Scorecard>* table) {
+    TRACE_SCOPE("ai.turn", "ai");
+    array<bool, 5> held{}; held.fill(false);
+    for (int j = 0; j < 5; ++j) dice[j] = roll6();
+    if (rec) rec->roll(held, dice);
+    int rolls = 1;
+    while (rolls < 3) {
+        if (difficulty != AIDifficulty::EASY) {
+            held = chooseHold(dice, sc, table, 3 - rolls, round, difficulty);
+            bool all_held = true;
+            for (bool h : held) if (!h) { all_held = false; break; }
+            if (all_held) break;
+        }
+        for (int j = 0; j < 5; ++j) if (!held[j]) dice[j] = roll6();
+        if (rec) rec->roll(held, dice);
+        rolls++;
+    }
+    Category cat = chooseCategory(dice, sc, table, round, difficulty);
+    int bonusBefore = sc.yahtzeeBonusCount;
+    int score = applyScore(sc, cat, dice);
+    if (rec) rec->score(cat, score, sc.yahtzeeBonusCount > bonusBefore);
+    return cat;
 }
\ No newline at end of file
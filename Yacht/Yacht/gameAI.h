@@ -11,7 +11,10 @@
 using namespace std;
 
 // AI ̵ 
-enum class AIDifficulty { EASY, NORMAL, HARD };
+// WINPROB =  + Ĺݿ    1 Ȯ ִȭ, MCTS = ð  ȿ Ʈ Ž (gameMcts.h)
+// EXTERNAL = ܺ   (gameBot.h).   ų  ʰų Ʋ  
+enum class AIDifficulty { EASY, NORMAL, HARD, WINPROB, MCTS, EXTERNAL };
+string_view difficultyName(AIDifficulty difficulty);      // ȭ ǥÿ (, , ...)
 
 // AI  Լ
 Category chooseBestScoringCategory_Easy(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used);
@@ -19,4 +22,29 @@ pair<Category, int> findBestExpectedCategory_Normal(const Dice& d, const array<b
 array<bool, 5> chooseBestHoldStrategy_Hard(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft, int round);
 Category chooseBestScoringCategory(const Dice& d, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int round, AIDifficulty difficulty);
 
+// /  ĳ (Ű: ĵ ֻ +  ũ +  )
+struct DecisionCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t uncached = 0;      // ĳø  ¿   
+    size_t entries = 0;
+    size_t capacity = 0;
+};
+void setDecisionCacheEnabled(bool enabled);
+bool decisionCacheEnabled();
+void resetDecisionCache();
+DecisionCacheStats decisionCacheStats();
+
+//  ü  . table = ڱ ڽ    ( nullptr).
+// WINPROB  Ĺݿ table  · ϰ, MCTS  Žϸ,  ۿ  //  
+//  ƴ AI   ĭ 3 ϰ Ǹ (·    )  Ȯ Ǯ̸  (gameEndgame.h)
+array<bool, 5> chooseHold(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int rollsLeft, int round, AIDifficulty difficulty);
+Category chooseCategory(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int round, AIDifficulty difficulty);
+
+class ReplayRecorder;
+
+// ȭ   AI  ( ~  ) ϰ  īװ ȯ. rec   ÷̿ 
+Category playAITurn(Scorecard& sc, Dice& dice, int round, AIDifficulty difficulty, ReplayRecorder* rec = nullptr, const vector<Scorecard>* table = nullptr);
+
 #endif // GAMEAI_H
\ No newline at end of file
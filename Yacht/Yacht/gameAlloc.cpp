@@ -0,0 +1,216 @@
+#include "gameAlloc.h"
+#include "gameLogic.h"
+#include "gameAI.h"
+#include "gameOdds.h"
+#include "gameUI.h"
+
+#include <new>
+#include <cstdlib>
+#include <cstdio>
+#include <streambuf>
+
+// ===================  operator new ü ===================
+// īʹ  ʱȭ ϴ thread_local ̶  ȿ ᵵ ٽ Ҵ ʴ´
+static thread_local uint64_t t_allocCount = 0;
+static thread_local uint64_t t_allocBytes = 0;
+
+AllocCount allocThreadTotal() {
+    AllocCount c;
+    c.count = t_allocCount;
+    c.bytes = t_allocBytes;
+    return c;
+}
+
+#if YACHT_ALLOC_HOOK
+static void* countedAlloc(size_t n) {
+    ++t_allocCount;
+    t_allocBytes += n;
+    void* p = malloc(n ? n : 1);
+    if (!p) throw bad_alloc();
+    return p;
+}
+static void* countedAlignedAlloc(size_t n, align_val_t al) {
+    ++t_allocCount;
+    t_allocBytes += n;
+    size_t align = static_cast<size_t>(al);
+#ifdef _MSC_VER
+    void* p = _aligned_malloc(n ? n : 1, align);
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, align < sizeof(void*) ? sizeof(void*) : align, n ? n : 1) != 0) p = nullptr;
+#endif
+    if (!p) throw bad_alloc();
+    return p;
+}
+static void alignedFree(void* p) {
+#ifdef _MSC_VER
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+void* operator new(size_t n) { return countedAlloc(n); }
+void* operator new[](size_t n) { return countedAlloc(n); }
+void* operator new(size_t n, const nothrow_t&) noexcept { try { return countedAlloc(n); } catch (...) { return nullptr; } }
+void* operator new[](size_t n, const nothrow_t&) noexcept { try { return countedAlloc(n); } catch (...) { return nullptr; } }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+void operator delete(void* p, const nothrow_t&) noexcept { free(p); }
+void operator delete[](void* p, const nothrow_t&) noexcept { free(p); }
+
+void* operator new(size_t n, align_val_t al) { return countedAlignedAlloc(n, al); }
+void* operator new[](size_t n, align_val_t al) { return countedAlignedAlloc(n, al); }
+void operator delete(void* p, align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, align_val_t) noexcept { alignedFree(p); }
+void operator delete(void* p, size_t, align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, size_t, align_val_t) noexcept { alignedFree(p); }
+#endif
+
+// ===================   ===================
+void AllocSpanStats::add(const AllocCount& c) {
+    spans++;
+    if (c.count) spansWithAlloc++;
+    count += c.count;
+    bytes += c.bytes;
+    if (c.count > maxCount) maxCount = c.count;
+    if (c.bytes > maxBytes) maxBytes = c.bytes;
+}
+
+static AllocSpanStats g_turnStats, g_frameStats;
+AllocSpanStats& allocTurnStats() { return g_turnStats; }
+AllocSpanStats& allocFrameStats() { return g_frameStats; }
+void resetAllocStats() { g_turnStats = AllocSpanStats(); g_frameStats = AllocSpanStats(); }
+
+AllocSpan::~AllocSpan() {
+    if (!allocHookEnabled()) return;
+    AllocCount now = allocThreadTotal();
+    AllocCount d;
+    d.count = now.count - start.count;
+    d.bytes = now.bytes - start.bytes;
+    stats.add(d);
+}
+
+// =================== ü ˻ (--check-alloc) ===================
+// ȭ ׸ ˻  cout    (  Ҵ  )
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+struct CheckResult {
+    const char* name;
+    AllocCount first;       //  ( ǥ, thread_local, ĳ ʱȭ )
+    AllocCount steady;      //  ° 
+};
+
+template <typename Fn>
+static CheckResult measure(const char* name, Fn fn) {
+    CheckResult r{ name, {}, {} };
+    AllocCount a = allocThreadTotal();
+    fn();
+    AllocCount b = allocThreadTotal();
+    fn();
+    AllocCount c = allocThreadTotal();
+    r.first = { b.count - a.count, b.bytes - a.bytes };
+    r.steady = { c.count - b.count, c.bytes - b.bytes };
+    return r;
+}
+
+static Dice diceOfHand(int h) {
+    Dice d{};
+    int n = 0;
+    for (int f = 0; f < 6; ++f) for (int k = 0; k < dicetab::HAND_FACES[h][f]; ++k) d[n++] = f + 1;
+    return d;
+}
+
+int runAllocCheck() {
+    if (!allocHookEnabled()) {
+        cout << u8" 忡 Ҵ  ϴ. Debug ̳ YACHT_ALLOC_TRACE   ϼ." << endl;
+        return 2;
+    }
+    g_rng.seed(12345);
+    vector<CheckResult> results;
+    results.reserve(8);
+
+    // ȭ ׸:     (clearScreen  ͹̳ Ƿ)
+#ifdef _WIN32
+    HOUT = GetStdHandle(STD_OUTPUT_HANDLE);
+#endif
+    {
+        vector<Scorecard> players{ Scorecard(u8"÷̾1"), Scorecard(u8"ǻ1") };
+        players[0].setScore(Category::THREE_KIND, 12);
+        Dice dice{ 2, 3, 4, 4, 6 };
+        array<bool, 5> held{ false, true, true, false, false };
+        NullBuffer sink;
+        streambuf* old = cout.rdbuf(&sink);
+        results.push_back(measure(u8"ȭ ׸ (Ʈ )", [&]() {
+            setHintPanel(false);
+            for (int i = 0; i < 10; ++i) redrawAll(1 + i, i & 1, 2, dice, held, players, u8" īװ ȣ Էϼ: ", "", u8"ֻ ϴ...");
+        }));
+        results.push_back(measure(u8"ȭ ׸ (Ʈ )", [&]() {
+            setHintPanel(true);
+            for (int i = 0; i < 10; ++i) redrawAll(1 + i, 0, 1 + i % 2, dice, held, players, "[T]oggle, [R]eroll, [S]core, [H]int: ", u8"߸ ɾԴϴ.");
+            setHintPanel(false);
+        }));
+        results.push_back(measure(u8" ִϸ̼", [&]() { animateRoll(dice, held); }));
+        cout.rdbuf(old);
+        clearScreen();
+    }
+
+    results.push_back(measure(u8" ", []() {
+        Scorecard sc(u8"˻");
+        static volatile int sink = 0;
+        for (int h = 0; h < dicetab::HAND_COUNT; ++h) {
+            Dice d = diceOfHand(h);
+            for (int c = 0; c < dicetab::CAT_N; ++c) {
+                sc.clearScores();
+                if (h % 2) sc.setScore(Category::YAHTZEE, 50);
+                sink = sink + scoreCategory(static_cast<Category>(c), d) + scoreWithJoker(static_cast<Category>(c), d, sc);
+                sink = sink + applyScore(sc, static_cast<Category>(c), d) + sc.total();
+            }
+            sink = sink + static_cast<int>(checkForSpecialCombinations(d).size());
+        }
+    }));
+
+    results.push_back(measure(u8"AI  (//, ĳ /)", []() {
+        Scorecard sc(u8"˻");
+        Dice dice{};
+        const bool cacheWas = decisionCacheEnabled();
+        for (int game = 0; game < 30; ++game) {
+            setDecisionCacheEnabled(game % 2 == 0);
+            sc.clearScores();
+            for (int round = 1; round <= activeCategoryCount(); ++round) playAITurn(sc, dice, round, static_cast<AIDifficulty>(game % 3));
+        }
+        setDecisionCacheEnabled(cacheWas);
+    }));
+
+    results.push_back(measure(u8"Ʈ ", []() {
+        OddsHint hint;
+        for (int i = 0; i < 200; ++i) {
+            Dice d;
+            for (auto& v : d) v = roll6();
+            array<bool, 5> held{};
+            for (auto& h : held) h = roll6() > 3;
+            array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)> used{};
+            for (auto&& u : used) u = roll6() > 4;
+            computeOddsHint(d, held, used, 1 + i % 2, hint);
+        }
+    }));
+
+    bool ok = true;
+    cout << u8"κ Ҵ (  /  ° )" << endl;
+    for (const auto& r : results) {
+        bool pass = r.steady.count == 0;
+        ok = ok && pass;
+        char line[160];
+        snprintf(line, sizeof(line), "  %-4s %llu / %llu (%llu B)  ", pass ? "OK" : "FAIL",
+            static_cast<unsigned long long>(r.first.count), static_cast<unsigned long long>(r.steady.count), static_cast<unsigned long long>(r.steady.bytes));
+        cout << line << r.name << endl;
+    }
+    cout << (ok ? u8": ݺ ࿡ Ҵ " : u8": ݺ ࿡ Ҵ ϴ") << endl;
+    return ok ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#ifndef GAMEALLOC_H
+#define GAMEALLOC_H
+
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+// =================== Ҵ  ===================
+// Debug (_DEBUG) Ǵ YACHT_ALLOC_TRACE  ϰ ϸ  operator new  ٲ
+// 庰 Ҵ Ƚ/Ʈ .   忡     0 ̴
+#if defined(_DEBUG) || defined(YACHT_ALLOC_TRACE)
+#define YACHT_ALLOC_HOOK 1
+#else
+#define YACHT_ALLOC_HOOK 0
+#endif
+
+constexpr bool allocHookEnabled() { return YACHT_ALLOC_HOOK != 0; }
+
+struct AllocCount {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+//  忡 ݱ operator new  Ҵ 
+AllocCount allocThreadTotal();
+
+// (, ȭ ) .  ȭ  ϳ Ѵ
+struct AllocSpanStats {
+    uint64_t spans = 0;
+    uint64_t spansWithAlloc = 0;
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    uint64_t maxCount = 0;
+    uint64_t maxBytes = 0;
+
+    void add(const AllocCount& c);
+};
+
+AllocSpanStats& allocTurnStats();
+AllocSpanStats& allocFrameStats();
+void resetAllocStats();
+
+//  Ҹ Ҵ stats    Ѵ (  忡 ƹ͵  )
+class AllocSpan {
+public:
+    explicit AllocSpan(AllocSpanStats& stats) : stats(stats), start(allocThreadTotal()) {}
+    ~AllocSpan();
+    AllocSpan(const AllocSpan&) = delete;
+    AllocSpan& operator=(const AllocSpan&) = delete;
+
+private:
+    AllocSpanStats& stats;
+    AllocCount start;
+};
+
+//  , AI , Ʈ , ȭ ׸ θ     ٽ 
+// Ҵ ϳ   ( --check-alloc). ȯ μ  ڵ
+int runAllocCheck();
+
+#endif // GAMEALLOC_H
\ No newline at end of file
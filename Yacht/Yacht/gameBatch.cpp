@@ -0,0 +1,198 @@
+#include "gameBatch.h"
+#include "gameRules.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+
+// ===================   ===================
+void ScorecardBatch::resize(size_t games) {
+    n = games;
+    cells.assign(static_cast<size_t>(CAT_N) * n, 0);
+    upper.assign(n, 0);
+    lower.assign(n, 0);
+    yahtzeeBonus.assign(n, 0);
+    usedMask.assign(n, 0);
+    reset();
+}
+
+void ScorecardBatch::reset(RulesVariant rules) {
+    rules::withRules(rules, [this](auto r) {
+        using R = decltype(r);
+        inactive = static_cast<uint16_t>(((1 << CAT_N) - 1) & ~R::ACTIVE);
+        bonusThreshold = R::UPPER_BONUS_THRESHOLD;
+        bonusScore = R::UPPER_BONUS;
+    });
+    fill(cells.begin(), cells.end(), static_cast<int16_t>(0));
+    fill(upper.begin(), upper.end(), static_cast<int16_t>(0));
+    fill(lower.begin(), lower.end(), static_cast<int16_t>(0));
+    fill(yahtzeeBonus.begin(), yahtzeeBonus.end(), static_cast<int16_t>(0));
+    fill(usedMask.begin(), usedMask.end(), inactive);
+}
+
+void ScorecardBatch::clear(size_t game) {
+    for (int c = 0; c < CAT_N; ++c) cells[static_cast<size_t>(c) * n + game] = 0;
+    upper[game] = lower[game] = yahtzeeBonus[game] = 0;
+    usedMask[game] = inactive;
+}
+
+void ScorecardBatch::setScore(size_t game, Category cat, int score) {
+    const int c = static_cast<int>(cat);
+    int16_t& cell = cells[static_cast<size_t>(c) * n + game];
+    int16_t& sum = (c <= static_cast<int>(Category::SIXES)) ? upper[game] : lower[game];
+    sum = static_cast<int16_t>(sum + score - (((usedMask[game] >> c) & 1) ? cell : 0));
+    cell = static_cast<int16_t>(score);
+    usedMask[game] |= static_cast<uint16_t>(1 << c);
+}
+
+void ScorecardBatch::load(size_t game, const Scorecard& sc) {
+    uint16_t mask = 0;
+    for (int c = 0; c < CAT_N; ++c) {
+        cells[static_cast<size_t>(c) * n + game] = static_cast<int16_t>(sc.used[c] ? sc.scores[c] : 0);
+        mask |= static_cast<uint16_t>(sc.used[c] << c);
+    }
+    usedMask[game] = mask;
+    upper[game] = static_cast<int16_t>(sc.upperSum());
+    lower[game] = static_cast<int16_t>(sc.lowerSum());
+    yahtzeeBonus[game] = static_cast<int16_t>(sc.yahtzeeBonusCount);
+}
+
+void ScorecardBatch::store(size_t game, Scorecard& sc) const {
+    for (int c = 0; c < CAT_N; ++c) {
+        sc.scores[c] = cells[static_cast<size_t>(c) * n + game];
+        sc.used[c] = (usedMask[game] >> c) & 1;
+    }
+    sc.yahtzeeBonusCount = yahtzeeBonus[game];
+    sc.upperTotal = upper[game];
+    sc.lowerTotal = lower[game];
+}
+
+// Ʒ  б   迭 е Ѵ (  0/1  ϰų )
+void ScorecardBatch::totals(int32_t* out) const {
+    const int16_t* u = upper.data();
+    const int16_t* l = lower.data();
+    const int16_t* y = yahtzeeBonus.data();
+    const int th = bonusThreshold, bs = bonusScore;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = u[i] + (u[i] >= th) * bs + l[i] + y[i] * YAHTZEE_BONUS_SCORE;
+}
+
+int64_t ScorecardBatch::sumTotals() const {
+    const int16_t* u = upper.data();
+    const int16_t* l = lower.data();
+    const int16_t* y = yahtzeeBonus.data();
+    const int th = bonusThreshold, bs = bonusScore;
+    int64_t s = 0;
+    for (size_t i = 0; i < n; ++i)
+        s += u[i] + (u[i] >= th) * bs + l[i] + y[i] * YAHTZEE_BONUS_SCORE;
+    return s;
+}
+
+size_t ScorecardBatch::countUpperBonus() const {
+    const int16_t* u = upper.data();
+    const int th = bonusThreshold;
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++i) k += (u[i] >= th);
+    return k;
+}
+
+size_t ScorecardBatch::countUsed(Category cat) const {
+    const uint16_t* m = usedMask.data();
+    const int c = static_cast<int>(cat);
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++i) k += (m[i] >> c) & 1;
+    return k;
+}
+
+int64_t ScorecardBatch::sumColumn(Category cat) const {
+    const int16_t* col = column(cat);
+    int64_t s = 0;
+    for (size_t i = 0; i < n; ++i) s += col[i];
+    return s;
+}
+
+// =================== ġũ ===================
+//  հ   total():    (ʽ  ), Ʒ    ٽ 
+static int recomputedUpper(const Scorecard& sc) {
+    int s = 0;
+    for (int i = 0; i <= static_cast<int>(Category::SIXES); i++) if (sc.used[i]) s += sc.scores[i];
+    return s;
+}
+static int recomputedTotal(const Scorecard& sc) {
+    int lower = 0;
+    for (int i = static_cast<int>(Category::THREE_KIND); i <= static_cast<int>(Category::CHANCE); i++) if (sc.used[i]) lower += sc.scores[i];
+    return recomputedUpper(sc) + upperBonusFor(recomputedUpper(sc)) + lower + sc.yahtzeeBonusCount * YAHTZEE_BONUS_SCORE;
+}
+
+//        ĭ ϴ  ä.    
+static void fillGreedy(vector<Scorecard>& cards, ScorecardBatch& batch) {
+    const int rounds = activeCategoryCount();
+    for (size_t g = 0; g < cards.size(); ++g) {
+        Scorecard& sc = cards[g];
+        for (int r = 0; r < rounds; ++r) {
+            Dice d;
+            for (auto& v : d) v = roll6();
+            Category best = Category::CATEGORY_COUNT;
+            int bestScore = -1;
+            for (int c = 0; c < ScorecardBatch::CAT_N; ++c) {
+                if (sc.used[c]) continue;
+                int s = scoreWithJoker(static_cast<Category>(c), d, sc);
+                if (s > bestScore) { bestScore = s; best = static_cast<Category>(c); }
+            }
+            const int bonusBefore = sc.yahtzeeBonusCount;
+            batch.setScore(g, best, applyScore(sc, best, d));
+            if (sc.yahtzeeBonusCount != bonusBefore) batch.addYahtzeeBonus(g);
+        }
+    }
+}
+
+void runScorecardBenchmark(int games) {
+    if (games < 100) games = 100;
+    g_rng.seed(2024);
+    vector<Scorecard> cards(games, Scorecard(u8"ġ"));
+    ScorecardBatch batch(games);
+    fillGreedy(cards, batch);
+
+    // 1)   հ谡 
+    vector<int32_t> batchTotals(games);
+    batch.totals(batchTotals.data());
+    int mismatch = 0;
+    for (int g = 0; g < games; ++g)
+        if (cards[g].total() != recomputedTotal(cards[g]) || batchTotals[g] != cards[g].total()) mismatch++;
+    cout << u8" " << games << u8" հ : ġ " << mismatch << endl;
+
+    // 2)  ϳ հ ȸ ð
+    const int passes = (std::max)(1, 2000000 / games);
+    long long checksum = 0;
+    auto nsPerCard = [&](auto&& body) {
+        auto t0 = chrono::steady_clock::now();
+        for (int p = 0; p < passes; ++p) checksum += body();
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count() / (static_cast<double>(passes) * games);
+    };
+    double recomputeNs = nsPerCard([&]() { long long s = 0; for (const auto& sc : cards) s += recomputedTotal(sc); return s; });
+    double cachedNs = nsPerCard([&]() { long long s = 0; for (const auto& sc : cards) s += sc.total(); return s; });
+    double batchNs = nsPerCard([&]() { batch.totals(batchTotals.data()); return static_cast<long long>(batchTotals[passes % games]); });
+    const ScorecardBatch* volatile batchRef = &batch;      // ݺ       ϰ
+    double batchSumNs = nsPerCard([&]() { return static_cast<long long>(batchRef->sumTotals()); });
+    cout << fixed << setprecision(2)
+        << u8"հ 1:  " << recomputeNs << u8" ns,  հ " << cachedNs << u8" ns,  totals " << batchNs
+        << u8" ns,  sumTotals " << batchSumNs << " ns" << endl;
+
+    // 3)    (񱳸 total()  )
+    vector<Scorecard> a = cards, b = cards;
+    auto t0 = chrono::steady_clock::now();
+    sort(a.begin(), a.end(), [](const Scorecard& x, const Scorecard& y) { return recomputedTotal(x) > recomputedTotal(y); });
+    double sortRecompute = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    t0 = chrono::steady_clock::now();
+    sort(b.begin(), b.end(), [](const Scorecard& x, const Scorecard& y) { return x.total() > y.total(); });
+    double sortCached = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    cout << u8" " << games << u8":  " << sortRecompute << u8" ms,  հ " << sortCached << " ms" << endl;
+
+    // 4)  ü 
+    cout << setprecision(1) << u8" " << static_cast<double>(batch.sumTotals()) / games
+        << u8",  ʽ " << 100.0 * batch.countUpperBonus() / games << "%, "
+        << u8"Ʈ ĭ  " << static_cast<double>(batch.sumColumn(Category::YAHTZEE)) / batch.countUsed(Category::YAHTZEE)
+        << u8"  (checksum " << checksum << ")" << endl;
+}
\ No newline at end of file
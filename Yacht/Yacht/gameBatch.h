@@ -0,0 +1,63 @@
+#pragma once
+#ifndef GAMEBATCH_H
+#define GAMEBATCH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// ===================   (ü 迭 -> 迭 ü) ===================
+// ùķ̼/нó õ  Ѳ ٷ    
+//  ĭ  īװ   cells[c * size + game], հ/ʽ/ Ʈ Ǻ  迭
+//     Scorecard::setScore   O(1), ü ȸ б    Ϸ ȭѴ
+class ScorecardBatch {
+public:
+    static constexpr int CAT_N = static_cast<int>(Category::CATEGORY_COUNT);
+
+    explicit ScorecardBatch(size_t games = 0) { resize(games); }
+    void resize(size_t games);              //    
+    void reset() { reset(rulesVariant()); }  //  Ģ    ( ʴ ĭ  ó)
+    void reset(RulesVariant rules);
+    void clear(size_t game);                //  Ǹ   ( reset  Ģ)
+    size_t size() const { return n; }
+
+    //  
+    void setScore(size_t game, Category cat, int score);
+    void addYahtzeeBonus(size_t game) { yahtzeeBonus[game]++; }
+    bool used(size_t game, Category cat) const { return (usedMask[game] >> static_cast<int>(cat)) & 1; }
+    uint16_t usedBits(size_t game) const { return usedMask[game]; }
+    int score(size_t game, Category cat) const { return cells[static_cast<size_t>(cat) * n + game]; }
+    int upperSum(size_t game) const { return upper[game]; }
+    int lowerSum(size_t game) const { return lower[game]; }
+    int yahtzeeBonusCount(size_t game) const { return yahtzeeBonus[game]; }
+    int total(size_t game) const {
+        return upper[game] + (upper[game] >= bonusThreshold) * bonusScore + lower[game] + yahtzeeBonus[game] * YAHTZEE_BONUS_SCORE;
+    }
+    void load(size_t game, const Scorecard& sc);
+    void store(size_t game, Scorecard& sc) const;
+
+    //  
+    void totals(int32_t* out) const;        // out[size]
+    int64_t sumTotals() const;
+    size_t countUpperBonus() const;
+    size_t countUsed(Category cat) const;   // ش ĭ ä  
+    int64_t sumColumn(Category cat) const;  // ش ĭ   ( ĭ 0)
+    const int16_t* column(Category cat) const { return cells.data() + static_cast<size_t>(cat) * n; }
+
+private:
+    size_t n = 0;
+    vector<int16_t> cells;                  // [CAT_N * n]
+    vector<int16_t> upper, lower, yahtzeeBonus;
+    vector<uint16_t> usedMask;
+    uint16_t inactive = 0;
+    int bonusThreshold = 0, bonusScore = 0;  //  reset Ģ  ʽ ( ȿ Ģ б  )
+};
+
+// հ ȸ/   İ  ,  ü ȸ  ( --bench-scorecard)
+void runScorecardBenchmark(int games);
+
+#endif // GAMEBATCH_H
\ No newline at end of file
@@ -0,0 +1,410 @@
+#include "gameBot.h"
+#include "gameAI.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+
+// =================== û/ ===================
+BotRequest makeBotRequest(uint32_t id, BotDecision kind, const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int rollsLeft, int round) {
+    BotRequest r{};
+    r.id = id;
+    r.kind = static_cast<uint8_t>(kind);
+    r.rollsLeft = static_cast<uint8_t>(rollsLeft);
+    r.round = static_cast<uint8_t>(round);
+    r.rules = static_cast<uint8_t>(rulesVariant());
+    for (int i = 0; i < 5; ++i) r.dice[i] = static_cast<uint8_t>(d[i]);
+    r.yachtScored = self.used[static_cast<int>(Category::YAHTZEE)] && self.scores[static_cast<int>(Category::YAHTZEE)] > 0;
+    for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) r.usedMask |= static_cast<uint16_t>(self.used[c] << c);
+    r.upperSum = static_cast<int16_t>(self.upperSum());
+    r.total = static_cast<int16_t>(self.total());
+    r.players = 1;
+    if (table) {
+        r.players = static_cast<uint8_t>(table->size());
+        for (const Scorecard& sc : *table)
+            if (&sc != &self) r.leaderTotal = static_cast<int16_t>((std::max)(static_cast<int>(r.leaderTotal), sc.total()));
+    }
+    return r;
+}
+
+bool botAnswerValid(const BotRequest& req, const BotAnswer& ans) {
+    if (ans.id != req.id) return false;
+    if (req.kind == static_cast<uint8_t>(BotDecision::HOLD)) return ans.value < 32;
+    return ans.value < static_cast<int>(Category::CATEGORY_COUNT) && !((req.usedMask >> ans.value) & 1);
+}
+
+void ExternalBot::decide(const BotRequest* req, size_t n, BotAnswer* out, bool* ok) {
+    lock_guard<mutex> lk(mtx);
+    auto t0 = chrono::steady_clock::now();
+    const int deadlineMs = timeoutMs * static_cast<int>((std::min)(n, static_cast<size_t>(BOT_MAX_BATCH)));
+    bool answered = false;
+    if (connected && n > 0 && n <= BOT_MAX_BATCH) answered = exchange(req, n, out, deadlineMs);
+    const double elapsed = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    if (answered && elapsed * 1000 > deadlineMs) answered = false;     // ̺귯  ʰ
+
+    botStats.calls++;
+    botStats.decisions += n;
+    botStats.seconds += elapsed;
+    for (size_t i = 0; i < n; ++i) {
+        ok[i] = answered && botAnswerValid(req[i], out[i]);
+        if (!answered) botStats.timeouts++;
+        else if (!ok[i]) botStats.invalid++;
+    }
+}
+
+BotStats ExternalBot::stats() const {
+    lock_guard<mutex> lk(mtx);
+    return botStats;
+}
+
+// ===================  μ /  ̺귯  ===================
+class LibraryBot : public ExternalBot {
+public:
+    LibraryBot(BotDecideFn fn, const string& name, void* handle) : fn(fn), handle(handle) { botName = name; }
+    ~LibraryBot() override {
+#ifdef _WIN32
+        if (handle) FreeLibrary(static_cast<HMODULE>(handle));
+#else
+        if (handle) dlclose(handle);
+#endif
+    }
+
+protected:
+    bool exchange(const BotRequest* req, size_t n, BotAnswer* out, int) override {
+        return fn(req, static_cast<uint32_t>(n), out) == static_cast<int32_t>(n);
+    }
+
+private:
+    BotDecideFn fn;
+    void* handle;
+};
+
+static unique_ptr<ExternalBot> openLibrary(const string& path) {
+#ifdef _WIN32
+    HMODULE h = LoadLibraryA(path.c_str());
+    if (!h) return nullptr;
+    auto decideFn = reinterpret_cast<BotDecideFn>(GetProcAddress(h, "yacht_bot_decide"));
+    auto nameFn = reinterpret_cast<BotNameFn>(GetProcAddress(h, "yacht_bot_name"));
+    if (!decideFn) { FreeLibrary(h); return nullptr; }
+#else
+    void* h = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!h) return nullptr;
+    auto decideFn = reinterpret_cast<BotDecideFn>(dlsym(h, "yacht_bot_decide"));
+    auto nameFn = reinterpret_cast<BotNameFn>(dlsym(h, "yacht_bot_name"));
+    if (!decideFn) { dlclose(h); return nullptr; }
+#endif
+    return make_unique<LibraryBot>(decideFn, nameFn ? string(nameFn()) : path, h);
+}
+
+// ===================   ===================
+static void putU32(vector<char>& buf, uint32_t v) {
+    for (int i = 0; i < 4; ++i) buf.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+}
+static uint32_t getU32(const char* p) {
+    return static_cast<uint8_t>(p[0]) | (static_cast<uint8_t>(p[1]) << 8) | (static_cast<uint8_t>(p[2]) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(p[3])) << 24);
+}
+
+class PipeBot : public ExternalBot {
+public:
+    ~PipeBot() override { shutdown(true); }
+
+    bool start(const string& command, int perDecisionMs) {
+        timeoutMs = perDecisionMs;
+        if (!spawn(command)) return false;
+        frame.clear();
+        putU32(frame, 3);
+        frame.push_back(static_cast<char>(BotMsg::HELLO));
+        frame.push_back(static_cast<char>(BOT_PROTOCOL_VERSION));
+        frame.push_back(static_cast<char>(rulesVariant()));
+        string name;
+        const auto deadline = chrono::steady_clock::now() + chrono::seconds(5);      //   ˳
+        if (!writeAll(frame.data(), frame.size()) || !readFrame(BotMsg::HELLO, deadline)) { shutdown(false); return false; }
+        botName.assign(reply.data(), reply.size());
+        if (botName.empty()) botName = command;
+        return true;
+    }
+
+protected:
+    bool exchange(const BotRequest* req, size_t n, BotAnswer* out, int deadlineMs) override {
+        const auto deadline = chrono::steady_clock::now() + chrono::milliseconds(deadlineMs);
+        frame.clear();
+        putU32(frame, static_cast<uint32_t>(1 + 4 + n * sizeof(BotRequest)));
+        frame.push_back(static_cast<char>(BotMsg::DECIDE));
+        putU32(frame, static_cast<uint32_t>(n));
+        const char* bytes = reinterpret_cast<const char*>(req);
+        frame.insert(frame.end(), bytes, bytes + n * sizeof(BotRequest));
+        if (!writeAll(frame.data(), frame.size()) || !readFrame(BotMsg::ANSWER, deadline) ||
+            reply.size() != 4 + n * sizeof(BotAnswer) || getU32(reply.data()) != n) {
+            shutdown(false);                //    û   ʵ ٷ ´
+            return false;
+        }
+        memcpy(out, reply.data() + 4, n * sizeof(BotAnswer));
+        return true;
+    }
+
+private:
+    vector<char> frame, reply;
+
+    bool readFrame(BotMsg expect, chrono::steady_clock::time_point deadline) {
+        char head[5];
+        if (!readExact(head, 5, deadline)) return false;
+        const uint32_t len = getU32(head);
+        if (len < 1 || len > 1 + 4 + BOT_MAX_BATCH * sizeof(BotAnswer) + 256 || static_cast<uint8_t>(head[4]) != static_cast<uint8_t>(expect)) return false;
+        reply.resize(len - 1);
+        return reply.empty() || readExact(reply.data(), reply.size(), deadline);
+    }
+
+#ifdef _WIN32
+    HANDLE process = nullptr, toChild = nullptr, fromChild = nullptr;
+
+    bool spawn(const string& command) {
+        SECURITY_ATTRIBUTES sa{ sizeof(sa), nullptr, TRUE };
+        HANDLE childIn = nullptr, childOut = nullptr;
+        if (!CreatePipe(&childIn, &toChild, &sa, 1 << 16)) return false;
+        if (!CreatePipe(&fromChild, &childOut, &sa, 1 << 16)) { CloseHandle(childIn); CloseHandle(toChild); toChild = nullptr; return false; }
+        SetHandleInformation(toChild, HANDLE_FLAG_INHERIT, 0);
+        SetHandleInformation(fromChild, HANDLE_FLAG_INHERIT, 0);
+        STARTUPINFOA si{};
+        si.cb = sizeof(si);
+        si.dwFlags = STARTF_USESTDHANDLES;
+        si.hStdInput = childIn;
+        si.hStdOutput = childOut;
+        si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+        PROCESS_INFORMATION pi{};
+        vector<char> cmd(command.begin(), command.end());
+        cmd.push_back('\0');
+        const BOOL ok = CreateProcessA(nullptr, cmd.data(), nullptr, nullptr, TRUE, CREATE_NO_WINDOW, nullptr, nullptr, &si, &pi);
+        CloseHandle(childIn);
+        CloseHandle(childOut);
+        if (!ok) { shutdown(false); return false; }
+        CloseHandle(pi.hThread);
+        process = pi.hProcess;
+        return true;
+    }
+    bool writeAll(const char* p, size_t len) {
+        while (len > 0) {
+            DWORD w = 0;
+            if (!toChild || !WriteFile(toChild, p, static_cast<DWORD>(len), &w, nullptr)) return false;
+            p += w; len -= w;
+        }
+        return true;
+    }
+    // ͸  ð  бⰡ Ƿ  Ʈ  д´
+    bool readExact(char* p, size_t len, chrono::steady_clock::time_point deadline) {
+        int idle = 0;
+        while (len > 0) {
+            DWORD avail = 0;
+            if (!fromChild || !PeekNamedPipe(fromChild, nullptr, 0, nullptr, &avail, nullptr)) return false;
+            if (avail == 0) {
+                if (chrono::steady_clock::now() >= deadline) return false;
+                if (++idle < 2000) SwitchToThread(); else Sleep(1);
+                continue;
+            }
+            DWORD r = 0;
+            if (!ReadFile(fromChild, p, (std::min)(avail, static_cast<DWORD>(len)), &r, nullptr)) return false;
+            p += r; len -= r;
+            idle = 0;
+        }
+        return true;
+    }
+    // graceful = BYE    Ḧ ٸ, ƴϸ ٷ  
+    void shutdown(bool graceful) {
+        connected = false;
+        if (toChild) {
+            const char bye[5] = { 1, 0, 0, 0, static_cast<char>(BotMsg::BYE) };
+            DWORD w = 0;
+            WriteFile(toChild, bye, sizeof(bye), &w, nullptr);
+            CloseHandle(toChild);
+            toChild = nullptr;
+        }
+        if (fromChild) { CloseHandle(fromChild); fromChild = nullptr; }
+        if (process) {
+            if (WaitForSingleObject(process, graceful ? 500 : 0) != WAIT_OBJECT_0) TerminateProcess(process, 1);
+            CloseHandle(process);
+            process = nullptr;
+        }
+    }
+#else
+    pid_t pid = -1;
+    int toChild = -1, fromChild = -1;
+
+    bool spawn(const string& command) {
+        int in[2], out[2];
+        if (pipe(in) != 0) return false;
+        if (pipe(out) != 0) { close(in[0]); close(in[1]); return false; }
+        signal(SIGPIPE, SIG_IGN);           //   ׾ write   ƿ
+        pid = fork();
+        if (pid < 0) { close(in[0]); close(in[1]); close(out[0]); close(out[1]); return false; }
+        if (pid == 0) {
+            dup2(in[0], 0);
+            dup2(out[1], 1);
+            close(in[0]); close(in[1]); close(out[0]); close(out[1]);
+            execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+        }
+        close(in[0]);
+        close(out[1]);
+        toChild = in[1];
+        fromChild = out[0];
+        return true;
+    }
+    bool writeAll(const char* p, size_t len) {
+        while (len > 0) {
+            ssize_t w = write(toChild, p, len);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return false;
+            p += w; len -= static_cast<size_t>(w);
+        }
+        return true;
+    }
+    bool readExact(char* p, size_t len, chrono::steady_clock::time_point deadline) {
+        while (len > 0) {
+            const auto left = chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now()).count();
+            if (left < 0) return false;
+            pollfd pfd{ fromChild, POLLIN, 0 };
+            const int pr = poll(&pfd, 1, static_cast<int>(left));
+            if (pr < 0 && errno == EINTR) continue;
+            if (pr <= 0) return false;
+            ssize_t r = read(fromChild, p, len);
+            if (r < 0 && errno == EINTR) continue;
+            if (r <= 0) return false;
+            p += r; len -= static_cast<size_t>(r);
+        }
+        return true;
+    }
+    // graceful = BYE    Ḧ ٸ, ƴϸ ٷ  
+    void shutdown(bool graceful) {
+        connected = false;
+        if (toChild >= 0) {
+            const char bye[5] = { 1, 0, 0, 0, static_cast<char>(BotMsg::BYE) };
+            if (write(toChild, bye, sizeof(bye)) < 0) {}
+            close(toChild);
+            toChild = -1;
+        }
+        if (fromChild >= 0) { close(fromChild); fromChild = -1; }
+        if (pid > 0) {
+            int status = 0;
+            for (int i = 0; graceful && i < 50 && waitpid(pid, &status, WNOHANG) == 0; ++i) usleep(10000);
+            if (waitpid(pid, &status, WNOHANG) == 0) { kill(pid, SIGKILL); waitpid(pid, &status, 0); }
+            pid = -1;
+        }
+    }
+#endif
+};
+
+unique_ptr<ExternalBot> ExternalBot::open(const string& spec, int timeoutMsPerDecision) {
+    auto endsWith = [&](const char* ext) {
+        const size_t n = strlen(ext);
+        return spec.size() > n && spec.compare(spec.size() - n, n, ext) == 0;
+    };
+    if (endsWith(".dll") || endsWith(".so") || endsWith(".dylib")) {
+        auto bot = openLibrary(spec);
+        if (bot) bot->timeoutMs = timeoutMsPerDecision;
+        return bot;
+    }
+    auto bot = make_unique<PipeBot>();
+    if (!bot->start(spec, timeoutMsPerDecision)) return nullptr;
+    return bot;
+}
+
+unique_ptr<ExternalBot> ExternalBot::inProcess(BotDecideFn fn, const string& name) {
+    return make_unique<LibraryBot>(fn, name, nullptr);
+}
+
+// =================== ӿ    ===================
+static unique_ptr<ExternalBot> g_externalBot;
+
+void setExternalBot(unique_ptr<ExternalBot> bot) { g_externalBot = move(bot); }
+ExternalBot* externalBot() { return g_externalBot.get(); }
+
+array<bool, 5> chooseHold_Bot(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int rollsLeft, int round) {
+    BotRequest req = makeBotRequest(0, BotDecision::HOLD, d, self, table, rollsLeft, round);
+    BotAnswer ans{};
+    bool ok = false;
+    g_externalBot->decide(&req, 1, &ans, &ok);
+    if (!ok) return chooseBestHoldStrategy_Hard(d, self.used, rollsLeft, round);
+    array<bool, 5> held{};
+    for (int i = 0; i < 5; ++i) held[i] = (ans.value >> i) & 1;
+    return held;
+}
+
+Category chooseCategory_Bot(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int round) {
+    BotRequest req = makeBotRequest(0, BotDecision::CATEGORY, d, self, table, 0, round);
+    BotAnswer ans{};
+    bool ok = false;
+    g_externalBot->decide(&req, 1, &ans, &ok);
+    if (!ok) return chooseBestScoringCategory(d, self.used, round, AIDifficulty::HARD);
+    return static_cast<Category>(ans.value);
+}
+
+// =================== ġũ ===================
+// batch   ڷ ϸ  ܰ踶      ´
+static double playBatched(ExternalBot& bot, int games, int batch) {
+    long long scoreSum = 0;
+    vector<Scorecard> cards(batch);
+    vector<Dice> dice(batch);
+    vector<BotRequest> req(batch);
+    vector<BotAnswer> ans(batch);
+    unique_ptr<bool[]> ok(new bool[batch]);
+    for (int start = 0; start < games; start += batch) {
+        const int n = (std::min)(batch, games - start);
+        for (int i = 0; i < n; ++i) cards[i].clearScores();
+        for (int round = 1; round <= activeCategoryCount(); ++round) {
+            for (int i = 0; i < n; ++i) for (auto& v : dice[i]) v = roll6();
+            for (int rollsLeft = 2; rollsLeft >= 1; --rollsLeft) {
+                for (int i = 0; i < n; ++i) req[i] = makeBotRequest(static_cast<uint32_t>(i), BotDecision::HOLD, dice[i], cards[i], nullptr, rollsLeft, round);
+                bot.decide(req.data(), n, ans.data(), ok.get());
+                for (int i = 0; i < n; ++i) {
+                    array<bool, 5> held{};
+                    if (ok[i]) for (int k = 0; k < 5; ++k) held[k] = (ans[i].value >> k) & 1;
+                    else held = chooseBestHoldStrategy_Hard(dice[i], cards[i].used, rollsLeft, round);
+                    for (int k = 0; k < 5; ++k) if (!held[k]) dice[i][k] = roll6();
+                }
+            }
+            for (int i = 0; i < n; ++i) req[i] = makeBotRequest(static_cast<uint32_t>(i), BotDecision::CATEGORY, dice[i], cards[i], nullptr, 0, round);
+            bot.decide(req.data(), n, ans.data(), ok.get());
+            for (int i = 0; i < n; ++i) {
+                Category cat = ok[i] ? static_cast<Category>(ans[i].value) : chooseBestScoringCategory(dice[i], cards[i].used, round, AIDifficulty::HARD);
+                applyScore(cards[i], cat, dice[i]);
+            }
+        }
+        for (int i = 0; i < n; ++i) scoreSum += cards[i].total();
+    }
+    return static_cast<double>(scoreSum) / games;
+}
+
+void runBotBenchmark(const string& self, int games) {
+    if (games < 1) games = 1;
+    cout << left << setw(18) << u8"" << right << setw(8) << u8"" << setw(12) << u8"պ" << setw(14) << u8"/s" << setw(12) << u8"us/"
+        << setw(10) << u8"" << setw(12) << u8" " << endl;
+    for (int mode = 0; mode < 2; ++mode) {
+        for (int batch : { 1, 16, 256 }) {
+            if (batch > games && batch != 1) break;
+            unique_ptr<ExternalBot> bot = mode == 0 ? ExternalBot::inProcess(exampleBotDecide, "example")
+                : ExternalBot::open("\"" + self + "\" --bot-example", 1000);
+            if (!bot) { cout << u8"   ߽ϴ: " << self << endl; return; }
+            g_rng.seed(7);
+            const double mean = playBatched(*bot, games, batch);
+            const BotStats s = bot->stats();
+            cout << left << setw(18) << (mode == 0 ? u8" μ" : u8"") << right << setw(8) << batch << setw(12) << s.calls
+                << fixed << setprecision(0) << setw(14) << s.decisions / s.seconds << setprecision(2) << setw(12) << 1e6 * s.seconds / s.decisions
+                << setw(10) << s.timeouts + s.invalid << setprecision(1) << setw(12) << mean << endl;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+#ifndef GAMEBOT_H
+#define GAMEBOT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <array>
+#include <memory>
+#include <mutex>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// =================== ܺ   ===================
+// ٱ AI  ڽ μ(ǥ  ) Ǵ  ̺귯 δ
+//  : [u32 (Ÿ+̷ε, LE)][u8 Ÿ][̷ε]
+//   HELLO  ȣƮ -> : [u8 ][u8 Ģ]           -> ȣƮ:  ̸ (UTF-8,  Ʈ)
+//   DECIDE ȣƮ -> : [u32 ][BotRequest x ]
+//   ANSWER  -> ȣƮ: [u32 ][BotAnswer x ]  (û  ,  id)
+//   BYE    ȣƮ -> : ̷ε .  Ѵ
+//      ӿ  Ƿ ùķʹ        պ óѴ
+constexpr uint8_t BOT_PROTOCOL_VERSION = 1;
+constexpr uint32_t BOT_MAX_BATCH = 4096;
+
+enum class BotMsg : uint8_t { HELLO = 1, DECIDE, ANSWER, BYE };
+enum class BotDecision : uint8_t { HOLD = 0, CATEGORY = 1 };
+
+#pragma pack(push, 1)
+struct BotRequest {
+    uint32_t id;
+    uint8_t kind;               // BotDecision
+    uint8_t rollsLeft;          // HOLD   1~2
+    uint8_t round;
+    uint8_t rules;              // RulesVariant
+    uint8_t dice[5];
+    uint8_t yachtScored;        //  ĭ 50 ߴ (Ŀ/ʽ )
+    uint16_t usedMask;          // bit c = ĭ c  (Ģ  ĭ )
+    int16_t upperSum;
+    int16_t total;
+    int16_t leaderTotal;        // ٸ ÷̾  ְ  (ȥڸ 0)
+    uint8_t players;
+    uint8_t reserved[5];
+};
+struct BotAnswer {
+    uint32_t id;
+    uint8_t value;              // HOLD:  ֻ Ʈ ũ, CATEGORY: ĭ ȣ
+};
+#pragma pack(pop)
+static_assert(sizeof(BotRequest) == 28, "BotRequest  28Ʈ ");
+static_assert(sizeof(BotAnswer) == 5, "BotAnswer  5Ʈ ");
+
+#ifndef YACHT_API
+#ifdef _WIN32
+#define YACHT_API extern "C" __declspec(dllexport)
+#else
+#define YACHT_API extern "C" __attribute__((visibility("default")))
+#endif
+#endif
+
+BotRequest makeBotRequest(uint32_t id, BotDecision kind, const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int rollsLeft, int round);
+bool botAnswerValid(const BotRequest& req, const BotAnswer& ans);
+
+//  ̺귯   Լ (yacht_bot_decide, : yacht_bot_name)   ȯ (count     ó)
+using BotDecideFn = int32_t(*)(const BotRequest* req, uint32_t count, BotAnswer* out);
+using BotNameFn = const char* (*)();
+
+struct BotStats {
+    uint64_t calls = 0;             // decide ȣ(պ) 
+    uint64_t decisions = 0;
+    uint64_t timeouts = 0;          // ð ȿ    
+    uint64_t invalid = 0;           // Ģ  ʴ  
+    double seconds = 0;             // decide ȿ  ð
+};
+
+// ===================   ===================
+class ExternalBot {
+public:
+    // spec  .dll/.so/.dylib   ̺귯, ƴϸ   . ϸ nullptr
+    static unique_ptr<ExternalBot> open(const string& spec, int timeoutMsPerDecision);
+    //  μ Լ ״ θ  ( , )
+    static unique_ptr<ExternalBot> inProcess(BotDecideFn fn, const string& name);
+    virtual ~ExternalBot() = default;
+
+    // n     ´. ok[i] =  ð ȿ ԰ Ģ  (ƴϸ ȣڰ ⺻ AI  )
+    // ð ѵ =  ѵ x n.   ѵ ѱ Ʈ ߳Ƿ   Ĵ  
+    // ̺귯  ߰   Ƿ   ѵ Ѱ  
+    void decide(const BotRequest* req, size_t n, BotAnswer* out, bool* ok);
+    const string& name() const { return botName; }
+    bool alive() const { return connected; }
+    BotStats stats() const;
+
+protected:
+    string botName;
+    int timeoutMs = 50;
+    bool connected = true;
+    virtual bool exchange(const BotRequest* req, size_t n, BotAnswer* out, int deadlineMs) = 0;
+
+private:
+    mutable mutex mtx;                  //   Ʈ̹Ƿ     ϳ
+    BotStats botStats;
+};
+
+// AIDifficulty::EXTERNAL     (  AI  )
+void setExternalBot(unique_ptr<ExternalBot> bot);
+ExternalBot* externalBot();
+array<bool, 5> chooseHold_Bot(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int rollsLeft, int round);
+Category chooseCategory_Bot(const Dice& d, const Scorecard& self, const vector<Scorecard>* table, int round);
+
+// ===================   (gameBotExample.cpp) ===================
+//    ,       ĭ Ѵ
+int32_t exampleBotDecide(const BotRequest* req, uint32_t count, BotAnswer* out);
+// ǥ   óϴ   ( --bot-example)
+int runExampleBot();
+
+// / μ   ũ⺰ ʴ   ( --bench-bot). self =    
+void runBotBenchmark(const string& self, int games);
+
+#endif // GAMEBOT_H
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "gameBot.h"
+#include "gameRules.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// ===================   ===================
+// ܺ    .  ü(gameBot.h)  Ŀθ 
+template <class R>
+static uint8_t decideOne(const BotRequest& r) {
+    using K = rules::Kernel<R>;
+    int dice[5];
+    for (int i = 0; i < 5; ++i) dice[i] = r.dice[i];
+
+    if (r.kind == static_cast<uint8_t>(BotDecision::HOLD)) {
+        int count[7] = {}, face = 1;
+        for (int v : dice) count[v]++;
+        for (int f = 2; f <= 6; ++f) if (count[f] >= count[face]) face = f;
+        uint8_t mask = 0;
+        for (int i = 0; i < 5; ++i) if (dice[i] == face) mask |= static_cast<uint8_t>(1 << i);
+        return mask;
+    }
+
+    int best = -1, bestScore = -1;
+    for (int c = 0; c < K::CAT_N; ++c) {
+        if ((r.usedMask >> c) & 1) continue;
+        const Category cat = static_cast<Category>(c);
+        const int s = K::scoreWithJoker(cat, dice, r.yachtScored != 0, (r.usedMask >> (dice[0] - 1)) & 1);
+        if (s > bestScore) { bestScore = s; best = c; }
+    }
+    return static_cast<uint8_t>(best);
+}
+
+int32_t exampleBotDecide(const BotRequest* req, uint32_t count, BotAnswer* out) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const RulesVariant v = req[i].rules < static_cast<uint8_t>(RulesVariant::COUNT) ? static_cast<RulesVariant>(req[i].rules) : RulesVariant::YAHTZEE;
+        out[i].id = req[i].id;
+        out[i].value = rules::withRules(v, [&](auto r) { return decideOne<decltype(r)>(req[i]); });
+    }
+    return static_cast<int32_t>(count);
+}
+
+//   ϳ  ̺귯 ص ȴ (--bot  .dll/.so η )
+YACHT_API int32_t yacht_bot_decide(const BotRequest* req, uint32_t count, BotAnswer* out) { return exampleBotDecide(req, count, out); }
+YACHT_API const char* yacht_bot_name() { return "example"; }
+
+// ===================   ===================
+static bool readExact(void* p, size_t len) { return len == 0 || fread(p, 1, len, stdin) == len; }
+
+static void writeFrame(BotMsg type, const void* payload, size_t len) {
+    const uint32_t total = static_cast<uint32_t>(len + 1);
+    unsigned char head[5] = { static_cast<unsigned char>(total), static_cast<unsigned char>(total >> 8),
+        static_cast<unsigned char>(total >> 16), static_cast<unsigned char>(total >> 24), static_cast<unsigned char>(type) };
+    fwrite(head, 1, sizeof(head), stdout);
+    if (len) fwrite(payload, 1, len, stdout);
+    fflush(stdout);
+}
+
+int runExampleBot() {
+#ifdef _WIN32
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    vector<char> payload, answer;
+    vector<BotRequest> req;
+    vector<BotAnswer> out;
+    for (;;) {
+        unsigned char head[5];
+        if (!readExact(head, sizeof(head))) return 0;
+        const uint32_t len = head[0] | (head[1] << 8) | (head[2] << 16) | (static_cast<uint32_t>(head[3]) << 24);
+        if (len < 1) return 1;
+        payload.resize(len - 1);
+        if (!readExact(payload.data(), payload.size())) return 0;
+
+        switch (static_cast<BotMsg>(head[4])) {
+        case BotMsg::HELLO:
+            writeFrame(BotMsg::HELLO, "example", 7);
+            break;
+        case BotMsg::DECIDE: {
+            uint32_t n = 0;
+            if (payload.size() < 4) return 1;
+            memcpy(&n, payload.data(), 4);
+            if (n > BOT_MAX_BATCH || payload.size() != 4 + n * sizeof(BotRequest)) return 1;
+            req.resize(n);
+            memcpy(req.data(), payload.data() + 4, n * sizeof(BotRequest));
+            out.resize(n);
+            exampleBotDecide(req.data(), n, out.data());
+            answer.resize(4 + n * sizeof(BotAnswer));
+            memcpy(answer.data(), &n, 4);
+            memcpy(answer.data() + 4, out.data(), n * sizeof(BotAnswer));
+            writeFrame(BotMsg::ANSWER, answer.data(), answer.size());
+            break;
+        }
+        case BotMsg::BYE:
+            return 0;
+        default:
+            return 1;
+        }
+    }
+}
\ No newline at end of file
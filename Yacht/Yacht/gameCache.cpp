@@ -0,0 +1,129 @@
+#include "gameCache.h"
+
+#include <algorithm>
+
+DecisionCache::DecisionCache(size_t capacity, int shardCount) {
+    size_t n = 1;
+    while (n < static_cast<size_t>(shardCount) && n < 256) n <<= 1;
+    shardMask = static_cast<uint32_t>(n - 1);
+    size_t perShard = (capacity + n - 1) / n;
+    if (perShard < 8) perShard = 8;
+    size_t indexSize = 1;
+    while (indexSize < perShard * 2) indexSize <<= 1;     //  50% 
+
+    for (size_t i = 0; i < n; ++i) {
+        auto sh = make_unique<Shard>();
+        sh->slots.resize(perShard);
+        sh->referenced.assign(perShard, 0);
+        sh->index.assign(indexSize, -1);
+        shards.push_back(move(sh));
+    }
+}
+
+uint32_t DecisionCache::mix(uint32_t key) {
+    key ^= key >> 16; key *= 0x7feb352du;
+    key ^= key >> 15; key *= 0x846ca68bu;
+    key ^= key >> 16;
+    return key;
+}
+
+size_t DecisionCache::Shard::find(uint32_t key, uint32_t hash) const {
+    const size_t mask = index.size() - 1;
+    size_t pos = home(hash);
+    while (index[pos] >= 0 && slots[index[pos]].key != key) pos = (pos + 1) & mask;
+    return pos;
+}
+
+//  Ž ο  ĭ  ڵ ׸  Ž 罽 Ѵ
+void DecisionCache::Shard::eraseAt(size_t pos) {
+    const size_t mask = index.size() - 1;
+    size_t hole = pos;
+    size_t j = pos;
+    while (true) {
+        j = (j + 1) & mask;
+        if (index[j] < 0) break;
+        size_t k = home(mix(slots[index[j]].key));
+        bool between = (hole <= j) ? (hole < k && k <= j) : (hole < k || k <= j);
+        if (!between) {
+            index[hole] = index[j];
+            hole = j;
+        }
+    }
+    index[hole] = -1;
+}
+
+bool DecisionCache::lookup(uint32_t key, uint32_t& value) {
+    uint32_t h = mix(key);
+    Shard& sh = *shards[h & shardMask];
+    lock_guard<mutex> lock(sh.mtx);
+    size_t pos = sh.find(key, h);
+    if (sh.index[pos] < 0) {
+        sh.misses.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+    int32_t slot = sh.index[pos];
+    sh.referenced[slot] = 1;
+    value = sh.slots[slot].value;
+    sh.hits.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+void DecisionCache::insert(uint32_t key, uint32_t value) {
+    uint32_t h = mix(key);
+    Shard& sh = *shards[h & shardMask];
+    lock_guard<mutex> lock(sh.mtx);
+    size_t pos = sh.find(key, h);
+    if (sh.index[pos] >= 0) {                       // ٸ 尡  
+        sh.slots[sh.index[pos]].value = value;
+        return;
+    }
+
+    size_t slot;
+    if (sh.used < sh.slots.size()) {
+        slot = sh.used++;
+    }
+    else {
+        // CLOCK:  Ʈ   Ʈ  
+        while (sh.referenced[sh.hand]) {
+            sh.referenced[sh.hand] = 0;
+            sh.hand = (sh.hand + 1) % sh.slots.size();
+        }
+        slot = sh.hand;
+        sh.hand = (sh.hand + 1) % sh.slots.size();
+        uint32_t oldKey = sh.slots[slot].key;
+        sh.eraseAt(sh.find(oldKey, mix(oldKey)));
+        sh.evictions.fetch_add(1, memory_order_relaxed);
+        pos = sh.find(key, h);                      // 鼭 ĭ   
+    }
+    sh.slots[slot] = { key, value };
+    sh.referenced[slot] = 0;
+    sh.index[pos] = static_cast<int32_t>(slot);
+}
+
+void DecisionCache::clear() {
+    for (auto& p : shards) {
+        Shard& sh = *p;
+        lock_guard<mutex> lock(sh.mtx);
+        fill(sh.index.begin(), sh.index.end(), -1);
+        fill(sh.referenced.begin(), sh.referenced.end(), static_cast<uint8_t>(0));
+        sh.used = 0;
+        sh.hand = 0;
+        sh.hits = 0;
+        sh.misses = 0;
+        sh.evictions = 0;
+    }
+}
+
+CacheStats DecisionCache::stats() const {
+    CacheStats st;
+    for (const auto& p : shards) {
+        const Shard& sh = *p;
+        st.hits += sh.hits.load(memory_order_relaxed);
+        st.misses += sh.misses.load(memory_order_relaxed);
+        st.evictions += sh.evictions.load(memory_order_relaxed);
+        st.capacity += sh.slots.size();
+        lock_guard<mutex> lock(sh.mtx);
+        st.entries += sh.used;
+    }
+    return st;
+}
\ No newline at end of file
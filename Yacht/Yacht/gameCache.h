@@ -0,0 +1,60 @@
+#pragma once
+#ifndef GAMECACHE_H
+#define GAMECACHE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+using namespace std;
+
+// =================== ũ  ü ĳ ===================
+// 32Ʈ Ű -> 32Ʈ . Ű ؽ÷ 带  帶  ϳ д.
+//   ũ  迭 +  巹 ̸,   CLOCK( ° ȸ) üѴ.
+//  Ŀ ޸𸮸 Ҵ ʴ´.
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t capacity = 0;
+};
+
+class DecisionCache {
+public:
+    DecisionCache(size_t capacity, int shardCount);
+
+    bool lookup(uint32_t key, uint32_t& value);
+    void insert(uint32_t key, uint32_t value);
+    void clear();                               // ׸ ī  ʱȭ
+    CacheStats stats() const;
+
+private:
+    struct Slot {
+        uint32_t key;
+        uint32_t value;
+    };
+    struct alignas(64) Shard {
+        mutable mutex mtx;
+        vector<Slot> slots;
+        vector<uint8_t> referenced;             // CLOCK  Ʈ
+        vector<int32_t> index;                  //  ȣ, -1 =  ĭ (ũ 2 ŵ)
+        size_t used = 0;
+        size_t hand = 0;
+        atomic<uint64_t> hits{ 0 }, misses{ 0 }, evictions{ 0 };
+
+        size_t home(uint32_t hash) const { return (hash >> 8) & (index.size() - 1); }
+        size_t find(uint32_t key, uint32_t hash) const;     //  ġ Ǵ Ű   ĭ
+        void eraseAt(size_t pos);
+    };
+
+    vector<unique_ptr<Shard>> shards;
+    uint32_t shardMask = 0;
+
+    static uint32_t mix(uint32_t key);
+};
+
+#endif // GAMECACHE_H
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "gameCheckpoint.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstddef>
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+
+const char* CHECKPOINT_FILE = "checkpoint.ysv";
+
+static CheckpointStats g_checkpointStats;
+
+static FILE* openFile(const char* path, const char* mode) {
+#ifdef _MSC_VER
+    FILE* f = nullptr;
+    return fopen_s(&f, path, mode) == 0 ? f : nullptr;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+static uint32_t fnv1a(const void* data, size_t len) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; ++i) { h ^= p[i]; h *= 16777619u; }
+    return h;
+}
+
+// UTF-8  ߰ ڸ ʵ maxBytes   踦 ã´
+static size_t utf8Prefix(const string& s, size_t maxBytes) {
+    if (s.size() <= maxBytes) return s.size();
+    size_t n = maxBytes;
+    while (n > 0 && (static_cast<uint8_t>(s[n]) & 0xC0) == 0x80) --n;
+    return n;
+}
+
+//    path ڿ .tmp   Ͽ 
+static void tempPath(char (&out)[512], const char* path) {
+    snprintf(out, sizeof(out), "%s.tmp", path);
+}
+
+static bool replaceFile(const char* from, const char* to, bool durable) {
+#ifdef _WIN32
+    DWORD flags = MOVEFILE_REPLACE_EXISTING | (durable ? MOVEFILE_WRITE_THROUGH : 0);
+    return MoveFileExA(from, to, flags) != 0;
+#else
+    (void)durable;
+    return rename(from, to) == 0;
+#endif
+}
+
+bool saveCheckpoint(int round, int current, int rolls, const Dice& dice, const array<bool, 5>& held,
+    const vector<Scorecard>& players, const vector<bool>& isComputer, const vector<AIDifficulty>& difficulty, bool durable, const char* path) {
+    auto t0 = chrono::steady_clock::now();
+
+    CheckpointFile cp;
+    memset(&cp, 0, sizeof(cp));
+    cp.magic = CHECKPOINT_MAGIC;
+    cp.version = 1;
+    cp.round = static_cast<uint8_t>(round);
+    cp.current = static_cast<uint8_t>(current);
+    cp.rolls = static_cast<uint8_t>(rolls);
+    cp.rules = static_cast<uint8_t>(rulesVariant());
+    for (int i = 0; i < 5; ++i) {
+        cp.dice[i] = static_cast<uint8_t>(dice[i]);
+        if (held[i]) cp.heldMask |= static_cast<uint8_t>(1 << i);
+    }
+    cp.playerCount = static_cast<uint8_t>((std::min)(players.size(), static_cast<size_t>(CHECKPOINT_MAX_PLAYERS)));
+    for (int p = 0; p < cp.playerCount; ++p) {
+        const Scorecard& sc = players[p];
+        CheckpointPlayer& out = cp.players[p];
+        memcpy(out.name, sc.name.data(), utf8Prefix(sc.name, CHECKPOINT_NAME_BYTES - 1));
+        for (int c = 0; c < 13; ++c) {
+            out.scores[c] = static_cast<int16_t>(sc.scores[c]);
+            if (sc.used[c]) out.usedMask |= static_cast<uint16_t>(1 << c);
+        }
+        out.yahtzeeBonusCount = static_cast<uint8_t>(sc.yahtzeeBonusCount);
+        out.isComputer = (p < static_cast<int>(isComputer.size()) && isComputer[p]) ? 1 : 0;
+        out.difficulty = static_cast<uint8_t>(p < static_cast<int>(difficulty.size()) ? difficulty[p] : AIDifficulty::EASY);
+    }
+    cp.checksum = fnv1a(&cp, offsetof(CheckpointFile, checksum));
+
+    char temp[512];
+    tempPath(temp, path);
+    bool ok = false;
+    if (FILE* f = openFile(temp, "wb")) {
+        ok = fwrite(&cp, sizeof(cp), 1, f) == 1 && fflush(f) == 0;
+        if (ok && durable) {
+#ifdef _WIN32
+            ok = _commit(_fileno(f)) == 0;
+#else
+            ok = fsync(fileno(f)) == 0;
+#endif
+        }
+        ok = (fclose(f) == 0) && ok;
+    }
+    ok = ok && replaceFile(temp, path, durable);
+
+    uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+    CheckpointStats& st = g_checkpointStats;
+    if (ok) {
+        st.saves++;
+        st.totalNs += ns;
+        st.lastNs = ns;
+        st.maxNs = (std::max)(st.maxNs, ns);
+    }
+    else {
+        st.failures++;
+    }
+    return ok;
+}
+
+bool loadCheckpoint(CheckpointState& out, const char* path) {
+    CheckpointFile cp;
+    FILE* f = openFile(path, "rb");
+    if (!f) return false;
+    bool read = fread(&cp, sizeof(cp), 1, f) == 1;
+    fclose(f);
+    if (!read || cp.magic != CHECKPOINT_MAGIC || cp.version != 1) return false;
+    if (cp.checksum != fnv1a(&cp, offsetof(CheckpointFile, checksum))) return false;
+    if (cp.playerCount < 1 || cp.playerCount > CHECKPOINT_MAX_PLAYERS) return false;
+    if (cp.round < 1 || cp.round > 13 || cp.current >= cp.playerCount || cp.rolls > 3) return false;
+    if (cp.rules >= static_cast<uint8_t>(RulesVariant::COUNT)) return false;
+
+    out.round = cp.round;
+    out.current = cp.current;
+    out.rolls = cp.rolls;
+    out.rules = static_cast<RulesVariant>(cp.rules);
+    for (int i = 0; i < 5; ++i) {
+        if (cp.dice[i] < 1 || cp.dice[i] > 6) return false;
+        out.dice[i] = cp.dice[i];
+        out.held[i] = (cp.heldMask >> i) & 1;
+    }
+    out.players.clear();
+    out.isComputer.clear();
+    out.difficulty.clear();
+    for (int p = 0; p < cp.playerCount; ++p) {
+        const CheckpointPlayer& in = cp.players[p];
+        Scorecard sc(string(in.name, strnlen(in.name, CHECKPOINT_NAME_BYTES)));
+        for (int c = 0; c < 13; ++c) {
+            sc.scores[c] = in.scores[c];
+            sc.used[c] = (in.usedMask >> c) & 1;
+        }
+        sc.yahtzeeBonusCount = in.yahtzeeBonusCount;
+        sc.recomputeTotals();
+        out.players.push_back(sc);
+        out.isComputer.push_back(in.isComputer != 0);
+        out.difficulty.push_back(in.difficulty <= static_cast<uint8_t>(AIDifficulty::EXTERNAL) ? static_cast<AIDifficulty>(in.difficulty) : AIDifficulty::EASY);
+    }
+    return true;
+}
+
+void removeCheckpoint(const char* path) {
+    char temp[512];
+    tempPath(temp, path);
+    remove(path);
+    remove(temp);
+}
+
+const CheckpointStats& checkpointStats() { return g_checkpointStats; }
+
+// =================== ġũ ===================
+void runCheckpointBenchmark(int iterations) {
+    if (iterations < 10) iterations = 10;
+    // ̾ϱ checkpoint.ysv  ǵ帮 ʵ  Ͽ 
+    const char* path = "checkpoint_bench.ysv";
+    vector<Scorecard> players;
+    vector<bool> isComputer;
+    vector<AIDifficulty> difficulty;
+    for (int p = 0; p < CHECKPOINT_MAX_PLAYERS; ++p) {
+        players.emplace_back(u8"÷̾" + to_string(p + 1));
+        for (int c = 0; c < 7; ++c) players[p].setScore(static_cast<Category>(c), c * 3);
+        isComputer.push_back(p > 0);
+        difficulty.push_back(static_cast<AIDifficulty>(p % 3));
+    }
+    Dice dice{ 1, 2, 3, 4, 5 };
+    array<bool, 5> held{ true, false, true, false, false };
+
+    auto measure = [&](const char* label, int n, bool durable) {
+        vector<uint64_t> ns;
+        ns.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            dice[i % 5] = i % 6 + 1;
+            if (!saveCheckpoint(i % 13 + 1, i % CHECKPOINT_MAX_PLAYERS, i % 4, dice, held, players, isComputer, difficulty, durable, path)) {
+                cout << label << u8":  " << endl;
+                return;
+            }
+            ns.push_back(checkpointStats().lastNs);
+        }
+        sort(ns.begin(), ns.end());
+        auto us = [&](double q) { return ns[static_cast<size_t>(q * (ns.size() - 1))] / 1000.0; };
+        cout << setw(16) << left << label << right << fixed << setprecision(1)
+            << " p50 " << setw(8) << us(0.5) << " us  p99 " << setw(8) << us(0.99) << " us  max " << setw(8) << ns.back() / 1000.0
+            << u8" us  (ִϸ̼ 1 60 ms  " << setprecision(3) << us(0.99) / 600.0 << "%)" << endl;
+    };
+
+    cout << u8" ũ: " << sizeof(CheckpointFile) << u8" Ʈ" << endl;
+    measure(u8"ӽ+rename", iterations, false);
+    measure(u8"fsync ", (std::max)(10, iterations / 20), true);
+
+    CheckpointState st;
+    auto t0 = chrono::steady_clock::now();
+    int loads = 0;
+    for (int i = 0; i < iterations; ++i) loads += loadCheckpoint(st, path) ? 1 : 0;
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    cout << u8"ҷ: " << setprecision(1) << sec * 1e6 / iterations << " us (" << loads << "/" << iterations << u8" )" << endl;
+    removeCheckpoint(path);
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+#ifndef GAMECHECKPOINT_H
+#define GAMECHECKPOINT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+
+#include "gameLogic.h"
+#include "gameAI.h"
+
+using namespace std;
+
+// ===================    üũƮ ===================
+//  ۰ /Ȧ 渶  ũ  ӽ Ͽ  rename  üѴ.
+// ü ̹Ƿ ߿ α׷ ׾    Ǵ    ϳ.
+extern const char* CHECKPOINT_FILE;
+
+constexpr uint32_t CHECKPOINT_MAGIC = 0x31504B43;   // "CKP1"
+constexpr int CHECKPOINT_MAX_PLAYERS = 5;
+constexpr int CHECKPOINT_NAME_BYTES = 48;
+
+#pragma pack(push, 1)
+struct CheckpointPlayer {
+    char name[CHECKPOINT_NAME_BYTES];           // UTF-8, NUL  ( ̸  迡 ڸ)
+    int16_t scores[13];
+    uint16_t usedMask;
+    uint8_t yahtzeeBonusCount;
+    uint8_t isComputer;
+    uint8_t difficulty;
+    uint8_t reserved;
+};
+struct CheckpointFile {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t round;
+    uint8_t current;
+    uint8_t rolls;                              // 0 =   
+    uint8_t heldMask;
+    uint8_t playerCount;
+    uint8_t rules;                              // RulesVariant (  0 = )
+    uint8_t dice[5];
+    uint8_t pad[3];
+    CheckpointPlayer players[CHECKPOINT_MAX_PLAYERS];
+    uint32_t checksum;                          // պκ ü FNV-1a
+};
+#pragma pack(pop)
+static_assert(sizeof(CheckpointFile) == 424, "CheckpointFile ̾ƿ ٲϴ");
+
+// ҷ  .  ÷̾ , ǻͰ ڿ  ¼  ״ Ѵ
+struct CheckpointState {
+    int round = 1;
+    int current = 0;
+    int rolls = 0;
+    RulesVariant rules = RulesVariant::YAHTZEE;  // ̾ϱ  setRulesVariant  ǵ
+    Dice dice{ 1, 1, 1, 1, 1 };
+    array<bool, 5> held{};
+    vector<Scorecard> players;
+    vector<bool> isComputer;
+    vector<AIDifficulty> difficulty;            // players    ( ¼ )
+};
+
+//  ð  (//ִ, )
+struct CheckpointStats {
+    uint64_t saves = 0;
+    uint64_t failures = 0;
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+    uint64_t lastNs = 0;
+};
+
+// durable = true  rename  ũ  (  ,  ms ҿ).
+// path  ⺻ ̾ϱ CHECKPOINT_FILE ̰, ġũ    
+bool saveCheckpoint(int round, int current, int rolls, const Dice& dice, const array<bool, 5>& held,
+    const vector<Scorecard>& players, const vector<bool>& isComputer, const vector<AIDifficulty>& difficulty, bool durable = false,
+    const char* path = CHECKPOINT_FILE);
+bool loadCheckpoint(CheckpointState& out, const char* path = CHECKPOINT_FILE);
+void removeCheckpoint(const char* path = CHECKPOINT_FILE);
+const CheckpointStats& checkpointStats();
+
+// /ҷ   ( --bench-checkpoint)
+void runCheckpointBenchmark(int iterations);
+
+#endif // GAMECHECKPOINT_H
\ No newline at end of file
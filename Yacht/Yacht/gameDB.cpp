@@ -1,46 +1,162 @@
+#include "gameNet.h"     // winsock2.h  mysql.h   
 #include "gameDB.h"
+#include "gameTrace.h"
 
-GameDB::GameDB(const string& server, const string& user, const string& password, const string& database)
-    : server(server), user(user), password(password), database(database), conn(nullptr) {
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <thread>
+
+// libmysqlclient    忡   ̺귯 ʱȭ  , 帶  ʱȭ   ؾ Ѵ
+static void mysqlLibraryInit() {
+    static once_flag once;
+    call_once(once, [] { mysql_library_init(0, nullptr, nullptr); });
+}
+struct MysqlThreadScope {
+    MysqlThreadScope() { mysql_thread_init(); }
+    ~MysqlThreadScope() { mysql_thread_end(); }
+};
+static void mysqlThreadInit() {
+    thread_local MysqlThreadScope scope;
+    (void)scope;
+}
+
+GameDB::GameDB(const string& server, const string& user, const string& password, const string& database, size_t maxConnections, unsigned int port)
+    : server(server), user(user), password(password), database(database), port(port), maxConnections((std::max)(size_t(1), maxConnections)) {
+    mysqlLibraryInit();
 }
 
 GameDB::~GameDB() {
     disconnect();
 }
 
-bool GameDB::connect() {
-    conn = mysql_init(NULL);
+MYSQL* GameDB::openConnection() {
+    TRACE_SCOPE("db.connect", "db");
+    mysqlThreadInit();
+    MYSQL* conn = mysql_init(NULL);
     if (!conn) {
-        cerr << "MySQL ʱȭ ." << endl;
-        return false;
+        if (logErrors.load(memory_order_relaxed)) cerr << "MySQL ʱȭ ." << endl;
+        return nullptr;
     }
 
-    if (!mysql_real_connect(conn, server.c_str(), user.c_str(), password.c_str(), database.c_str(), 0, NULL, 0)) {
-        cerr << "DB  : " << mysql_error(conn) << endl;
+    if (!mysql_real_connect(conn, server.c_str(), user.c_str(), password.c_str(), database.empty() ? NULL : database.c_str(), port, NULL, 0)) {
+        if (logErrors.load(memory_order_relaxed)) cerr << "DB  : " << mysql_error(conn) << endl;
         mysql_close(conn);
-        conn = nullptr;
-        return false;
+        return nullptr;
     }
 
     // ѱ  
     mysql_set_character_set(conn, "utf8mb4");
+    return conn;
+}
 
-    cout << "DB  ." << endl;
+bool GameDB::connect() {
+    Lease lease = acquire();
+    if (!lease) return false;
+    if (logErrors.load(memory_order_relaxed)) cout << "DB  ." << endl;
     return true;
 }
 
 void GameDB::disconnect() {
-    if (conn) {
-        mysql_close(conn);
-        conn = nullptr;
-    }
+    lock_guard<mutex> lock(mtx);
+    for (MYSQL* conn : idle) mysql_close(conn);
+    openCount -= idle.size();
+    idle.clear();
 }
 
-void GameDB::recordScore(const string& name, int score) {
+GameDB::Lease GameDB::acquire() {
+    mysqlThreadInit();
+    {
+        unique_lock<mutex> lock(mtx);
+        stats.checkouts++;
+        if (idle.empty() && openCount >= maxConnections) {
+            TRACE_SCOPE("db.poolWait", "db");
+            stats.waits++;
+            available.wait(lock, [&] { return !idle.empty() || openCount < maxConnections; });
+        }
+        if (!idle.empty()) {
+            MYSQL* conn = idle.back();
+            idle.pop_back();
+            return Lease(this, conn);
+        }
+        openCount++;                // ڸ     ۿ 
+    }
+    MYSQL* conn = openConnection();
+    lock_guard<mutex> lock(mtx);
     if (!conn) {
-        cerr << "DB  ʾ    ϴ." << endl;
-        return;
+        openCount--;
+        available.notify_one();
+        return Lease();
     }
+    stats.opened++;
+    return Lease(this, conn);
+}
+
+void GameDB::release(MYSQL* conn, bool broken) {
+    if (broken) mysql_close(conn);
+    lock_guard<mutex> lock(mtx);
+    if (broken) {
+        openCount--;
+        stats.discarded++;
+    }
+    else {
+        idle.push_back(conn);
+    }
+    available.notify_one();
+}
+
+void GameDB::Lease::checkAlive() {
+    if (conn && mysql_ping(conn) != 0) broken = true;
+}
+
+void GameDB::setLogErrors(bool enabled) {
+    logErrors.store(enabled, memory_order_relaxed);
+}
+
+void GameDB::reportError(const char* what, MYSQL* conn) {
+    if (logErrors.load(memory_order_relaxed)) cerr << what << mysql_error(conn) << endl;
+}
+
+DBPoolStats GameDB::poolStats() const {
+    lock_guard<mutex> lock(mtx);
+    DBPoolStats s = stats;
+    s.open = openCount;
+    return s;
+}
+
+bool GameDB::execute(const string& sql) {
+    Lease lease = acquire();
+    if (!lease) return false;
+    if (mysql_query(lease.get(), sql.c_str())) {
+        reportError(" : ", lease.get());
+        lease.checkAlive();
+        return false;
+    }
+    return true;
+}
+
+bool GameDB::recordScore(const string& name, int score) {
+    TRACE_SCOPE("db.recordScore", "db");
+    Lease lease = acquire();
+    if (!lease) {
+        if (logErrors.load(memory_order_relaxed)) cerr << "DB  ʾ    ϴ." << endl;
+        return false;
+    }
+    MYSQL* conn = lease.get();
 
     // SQL Injection   PreparedStatement  
     //  Ҵ  ũ⸦ 
@@ -56,29 +172,88 @@ void GameDB::recordScore(const string& name, int score) {
     query << "INSERT INTO score (name, score) VALUES ('" << escaped_name << "', " << score << ")";
 
     if (mysql_query(conn, query.str().c_str())) {
-        cerr << "  : " << mysql_error(conn) << endl;
+        reportError("  : ", conn);
+        lease.checkAlive();
+        return false;
     }
+    return true;
+}
+
+bool GameDB::recordScores(const vector<ScoreEntry>& entries) {
+    TRACE_SCOPE("db.recordScores", "db");
+    if (entries.empty()) return true;
+    Lease lease = acquire();
+    if (!lease) {
+        if (logErrors.load(memory_order_relaxed)) cerr << "DB  ʾ    ϴ." << endl;
+        return false;
+    }
+    MYSQL* conn = lease.get();
+
+    //   max_allowed_packet   ʵ ROWS_PER_QUERY پ , ü  Ʈ ´
+    const size_t ROWS_PER_QUERY = 500;
+    if (mysql_query(conn, "START TRANSACTION")) {
+        reportError("  : ", conn);
+        lease.checkAlive();
+        return false;
+    }
+    std::vector<char> to_buffer;
+    string query;
+    for (size_t first = 0; first < entries.size(); first += ROWS_PER_QUERY) {
+        const size_t last = (std::min)(entries.size(), first + ROWS_PER_QUERY);
+        query.assign("INSERT INTO score (name, score) VALUES ");
+        for (size_t i = first; i < last; ++i) {
+            const string& name = entries[i].name;
+            to_buffer.resize(2 * name.length() + 1);
+            unsigned long escaped_length = mysql_real_escape_string(conn, to_buffer.data(), name.c_str(), name.length());
+            if (i > first) query.append(", ");
+            query.append("('").append(to_buffer.data(), escaped_length).append("', ").append(to_string(entries[i].score)).append(")");
+        }
+        if (mysql_query(conn, query.c_str())) {
+            reportError("  : ", conn);
+            mysql_query(conn, "ROLLBACK");
+            lease.checkAlive();
+            return false;
+        }
+    }
+    if (mysql_query(conn, "COMMIT")) {
+        reportError("  : ", conn);
+        mysql_query(conn, "ROLLBACK");      //     Ʈ ݰ Ǯ ش
+        lease.checkAlive();
+        return false;
+    }
+    return true;
 }
 
 vector<ScoreEntry> GameDB::getTopScores(int count) {
     vector<ScoreEntry> topScores;
-    if (!conn) {
-        cerr << "DB  ʾ     ϴ." << endl;
-        return topScores;
+    getTopScores(count, topScores);
+    return topScores;
+}
+
+bool GameDB::getTopScores(int count, vector<ScoreEntry>& topScores) {
+    TRACE_SCOPE("db.getTopScores", "db");
+    topScores.clear();
+    Lease lease = acquire();
+    if (!lease) {
+        if (logErrors.load(memory_order_relaxed)) cerr << "DB  ʾ     ϴ." << endl;
+        return false;
     }
+    MYSQL* conn = lease.get();
 
     ostringstream query;
     query << "SELECT name, score FROM score ORDER BY score DESC, id ASC LIMIT " << count;
 
     if (mysql_query(conn, query.str().c_str())) {
-        cerr << " ȸ : " << mysql_error(conn) << endl;
-        return topScores;
+        reportError(" ȸ : ", conn);
+        lease.checkAlive();
+        return false;
     }
 
     MYSQL_RES* res = mysql_store_result(conn);
     if (res == NULL) {
-        cerr << "  : " << mysql_error(conn) << endl;
-        return topScores;
+        reportError("  : ", conn);
+        lease.checkAlive();
+        return false;
     }
 
     MYSQL_ROW row;
@@ -90,5 +265,323 @@ vector<ScoreEntry> GameDB::getTopScores(int count) {
     }
 
     mysql_free_result(res);
-    return topScores;
+    return true;
+}
+
+// ===================   ===================
+static double percentileMs(vector<uint32_t>& us, double q) {
+    if (us.empty()) return 0.0;
+    const size_t k = (std::min)(us.size() - 1, static_cast<size_t>(q * us.size()));
+    nth_element(us.begin(), us.begin() + k, us.end());
+    return us[k] / 1000.0;
+}
+
+// host  "local" ̸ ӽ  ͸ ʱȭϰ 127.0.0.1   Ʈ  .
+// root  ȣ  ,     ͸ .
+//    ȯ  YACHT_MYSQLD,  PATH  mariadbd, mysqld  ã´
+class LocalDBServer {
+public:
+    ~LocalDBServer() { stop(); }
+
+    bool start() {
+        const filesystem::path server = findServer();
+        if (server.empty()) {
+            cerr << u8"mariadbd/mysqld  ã  ϴ. PATH  ߰ϰų YACHT_MYSQLD  θ ϼ." << endl;
+            return false;
+        }
+        error_code ec;
+        dir = filesystem::temp_directory_path(ec) / ("yacht_db_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+        if (ec || !filesystem::create_directories(dir, ec)) {
+            cerr << u8"ӽ ͸   ϴ: " << dir.string() << endl;
+            dir.clear();
+            return false;
+        }
+        const filesystem::path data = dir / "data";
+        const filesystem::path log = dir / "server.log";
+
+        // MariaDB  mariadb-install-db , MySQL  mysqld --initialize-insecure  ý ǥ 
+        const bool maria = server.stem().string().find("mariadb") != string::npos;
+        string init;
+        if (maria) {
+            filesystem::path installer = server.parent_path() / ("mariadb-install-db" + server.extension().string());
+            if (!filesystem::exists(installer, ec)) installer = findOnPath("mariadb-install-db");
+            if (installer.empty()) {
+                cerr << u8"mariadb-install-db  ã  ϴ." << endl;
+                return false;
+            }
+#ifdef _WIN32
+            init = quote(installer) + " --datadir=" + quote(data);
+#else
+            init = quote(installer) + " --no-defaults --datadir=" + quote(data) + " --auth-root-authentication-method=normal --skip-test-db" + userOption();
+#endif
+        }
+        else {
+            init = quote(server) + " --no-defaults --initialize-insecure --datadir=" + quote(data) + userOption();
+        }
+        init += " > " + quote(dir / "init.log") + " 2>&1";
+#ifdef _WIN32
+        init = "\"" + init + "\"";      // cmd /c   յ ǥ  Ƿ    Ѵ
+#endif
+        if (system(init.c_str()) != 0) {
+            cerr << u8" ͸ ʱȭ " << endl;
+            printLog(dir / "init.log");
+            return false;
+        }
+
+        if (!netStartup()) return false;
+        const socket_t probe = listenTcp(0);
+        if (probe == INVALID_SOCK) return false;
+        portNo = localPort(probe);
+        closeSocket(probe);
+
+        string command = quote(server) + " --no-defaults --datadir=" + quote(data) + " --port=" + to_string(portNo)
+            + " --bind-address=127.0.0.1 --log-error=" + quote(log) + " --pid-file=" + quote(dir / "server.pid");
+#ifndef _WIN32
+        command += " --socket=" + quote(dir / "server.sock") + userOption();
+#endif
+        if (!spawn(command)) {
+            cerr << u8"   ϴ: " << server.string() << endl;
+            return false;
+        }
+
+        //     ٸ
+        GameDB probeDB("127.0.0.1", "root", "", "", 1, portNo);
+        probeDB.setLogErrors(false);
+        const auto deadline = chrono::steady_clock::now() + chrono::seconds(60);
+        while (chrono::steady_clock::now() < deadline) {
+            if (!running()) break;
+            if (probeDB.connect()) return true;
+            this_thread::sleep_for(chrono::milliseconds(250));
+        }
+        cerr << u8"ӽ  غ ʾҽϴ" << endl;
+        printLog(log);
+        return false;
+    }
+
+    void stop() {
+        halt();
+        if (!dir.empty()) {
+            error_code ec;
+            filesystem::remove_all(dir, ec);
+            dir.clear();
+        }
+    }
+
+    unsigned int port() const { return portNo; }
+
+private:
+    filesystem::path dir;
+    unsigned int portNo = 0;
+
+    static string quote(const filesystem::path& p) { return "\"" + p.string() + "\""; }
+
+    static filesystem::path findOnPath(const string& name) {
+        const char* path = getenv("PATH");
+        if (!path) return {};
+#ifdef _WIN32
+        const char sep = ';';
+        const string file = name + ".exe";
+#else
+        const char sep = ':';
+        const string& file = name;
+#endif
+        stringstream ss(path);
+        string entry;
+        error_code ec;
+        while (getline(ss, entry, sep)) {
+            if (entry.empty()) continue;
+            const filesystem::path candidate = filesystem::path(entry) / file;
+            if (filesystem::is_regular_file(candidate, ec)) return candidate;
+        }
+        return {};
+    }
+
+    static filesystem::path findServer() {
+        if (const char* env = getenv("YACHT_MYSQLD")) {
+            if (*env) return filesystem::path(env);
+        }
+        filesystem::path p = findOnPath("mariadbd");
+        return p.empty() ? findOnPath("mysqld") : p;
+    }
+
+    // root  ϸ  --user ̴  ʴ´
+    static string userOption() {
+#ifdef _WIN32
+        return "";
+#else
+        return geteuid() == 0 ? " --user=root" : "";
+#endif
+    }
+
+    static void printLog(const filesystem::path& p) {
+        ifstream in(p);
+        deque<string> tail;
+        string line;
+        while (getline(in, line)) {
+            tail.push_back(line);
+            if (tail.size() > 20) tail.pop_front();
+        }
+        for (const string& l : tail) cerr << "  " << l << endl;
+    }
+
+#ifdef _WIN32
+    HANDLE process = nullptr;
+
+    bool spawn(const string& command) {
+        STARTUPINFOA si{};
+        si.cb = sizeof(si);
+        PROCESS_INFORMATION pi{};
+        vector<char> cmd(command.begin(), command.end());
+        cmd.push_back('\0');
+        if (!CreateProcessA(nullptr, cmd.data(), nullptr, nullptr, FALSE, CREATE_NO_WINDOW, nullptr, nullptr, &si, &pi)) return false;
+        CloseHandle(pi.hThread);
+        process = pi.hProcess;
+        return true;
+    }
+    bool running() { return process && WaitForSingleObject(process, 0) == WAIT_TIMEOUT; }
+    void halt() {
+        if (!process) return;
+        TerminateProcess(process, 1);
+        WaitForSingleObject(process, 10000);
+        CloseHandle(process);
+        process = nullptr;
+    }
+#else
+    pid_t pid = -1;
+
+    bool spawn(const string& command) {
+        pid = fork();
+        if (pid < 0) return false;
+        if (pid == 0) {
+            const string exec = "exec " + command + " < /dev/null > /dev/null 2>&1";   // sh  ƴ϶   pid  
+            execl("/bin/sh", "sh", "-c", exec.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+        }
+        return true;
+    }
+    bool running() { return pid > 0 && waitpid(pid, nullptr, WNOHANG) == 0; }
+    // SIGTERM   Ḧ 10 ٸ   
+    void halt() {
+        if (pid <= 0) return;
+        int status = 0;
+        kill(pid, SIGTERM);
+        for (int i = 0; i < 1000 && waitpid(pid, &status, WNOHANG) == 0; ++i) usleep(10000);
+        if (waitpid(pid, &status, WNOHANG) == 0) { kill(pid, SIGKILL); waitpid(pid, &status, 0); }
+        pid = -1;
+    }
+#endif
+};
+
+int runDBBenchmark(const string& host, const string& user, const string& password, int maxClients, int poolSize, int seconds) {
+    if (maxClients < 1) maxClients = 1;
+    if (poolSize < 1) poolSize = 1;
+    if (seconds < 1) seconds = 1;
+
+    LocalDBServer local;
+    string server = host, login = user, secret = password;
+    unsigned int port = 0;
+    if (host == "local") {
+        cout << u8"ӽ  غϴ ..." << endl;
+        if (!local.start()) return 1;
+        server = "127.0.0.1";
+        login = "root";
+        secret.clear();
+        port = local.port();
+        cout << u8"ӽ : 127.0.0.1:" << port << endl;
+    }
+
+    //  ͺ̽ ǥ غ. Ͽ  ̸ load_  ϰ  
+    {
+        GameDB admin(server, login, secret, "", 1, port);
+        admin.setLogErrors(false);
+        if (!admin.connect()) {
+            cerr << u8"DB    ϴ (" << server << u8").   ϰų ȣƮ local  ּ." << endl;
+            return 1;
+        }
+        admin.setLogErrors(true);
+        if (!admin.execute("CREATE DATABASE IF NOT EXISTS yacht_load CHARACTER SET utf8mb4") ||
+            !admin.execute("CREATE TABLE IF NOT EXISTS yacht_load.score (id INT AUTO_INCREMENT PRIMARY KEY, "
+                "name VARCHAR(64) NOT NULL, score INT NOT NULL, KEY idx_score (score))")) return 1;
+        admin.execute("DELETE FROM yacht_load.score WHERE name LIKE 'load\\_%'");
+    }
+
+    cout << u8"   (Ӵ   2~5 +  10 ȸ),  Ǯ " << poolSize << u8", ܰ躰 " << seconds << u8"" << endl;
+    cout << setw(10) << u8"Ŭ̾Ʈ" << setw(10) << "games/s" << setw(10) << "ops/s"
+        << setw(20) << u8" p50/p99 ms" << setw(20) << u8"ȸ p50/p99 ms" << setw(10) << u8"" << setw(12) << u8"Ǯ " << endl;
+
+    vector<int> levels;
+    for (int c = 1; c < maxClients; c *= 2) levels.push_back(c);
+    levels.push_back(maxClients);
+
+    for (int clients : levels) {
+        GameDB db(server, login, secret, "yacht_load", static_cast<size_t>(poolSize), port);
+        db.setLogErrors(false);
+        if (!db.connect()) {
+            cerr << u8"DB  " << endl;
+            return 1;
+        }
+
+        struct ClientStats {
+            vector<uint32_t> recordUs, topUs;
+            uint64_t games = 0, ops = 0, errors = 0;
+        };
+        vector<ClientStats> per(clients);
+        atomic<bool> stop{ false };
+
+        auto client = [&](int idx) {
+            traceThreadName("db load client");
+            ClientStats& st = per[idx];
+            mt19937 rng(static_cast<unsigned>(1234 + idx));
+            vector<ScoreEntry> top;
+            string name;
+            while (!stop.load(memory_order_relaxed)) {
+                //  ϳ  ó ÷̾  ϰ ǥ   д´
+                const int players = 2 + static_cast<int>(rng() % 4);
+                for (int p = 0; p < players; ++p) {
+                    name.assign("load_").append(to_string(idx)).append("_").append(to_string(p));
+                    auto t0 = chrono::steady_clock::now();
+                    const bool ok = db.recordScore(name, 50 + static_cast<int>(rng() % 300));
+                    st.recordUs.push_back(static_cast<uint32_t>(chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - t0).count()));
+                    st.ops++;
+                    st.errors += !ok;
+                }
+                auto t0 = chrono::steady_clock::now();
+                const bool ok = db.getTopScores(10, top);
+                st.topUs.push_back(static_cast<uint32_t>(chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - t0).count()));
+                st.ops++;
+                st.errors += !ok;
+                st.games++;
+            }
+        };
+
+        auto t0 = chrono::steady_clock::now();
+        vector<thread> pool;
+        for (int i = 0; i < clients; ++i) pool.emplace_back(client, i);
+        this_thread::sleep_for(chrono::seconds(seconds));
+        stop = true;
+        for (auto& t : pool) t.join();
+        const double elapsed = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+        ClientStats all;
+        for (auto& st : per) {
+            all.recordUs.insert(all.recordUs.end(), st.recordUs.begin(), st.recordUs.end());
+            all.topUs.insert(all.topUs.end(), st.topUs.begin(), st.topUs.end());
+            all.games += st.games;
+            all.ops += st.ops;
+            all.errors += st.errors;
+        }
+        const DBPoolStats ps = db.poolStats();
+        ostringstream rec, top;
+        rec << fixed << setprecision(2) << percentileMs(all.recordUs, 0.5) << " / " << percentileMs(all.recordUs, 0.99);
+        top << fixed << setprecision(2) << percentileMs(all.topUs, 0.5) << " / " << percentileMs(all.topUs, 0.99);
+        cout << setw(10) << clients << fixed << setprecision(0) << setw(10) << all.games / elapsed << setw(10) << all.ops / elapsed
+            << setw(20) << rec.str() << setw(20) << top.str()
+            << setw(9) << setprecision(2) << (all.ops ? 100.0 * all.errors / all.ops : 0.0) << "%"
+            << setw(11) << setprecision(1) << (ps.checkouts ? 100.0 * ps.waits / ps.checkouts : 0.0) << "%" << endl;
+    }
+
+    GameDB cleanup(server, login, secret, "yacht_load", 1, port);
+    cleanup.setLogErrors(false);
+    if (cleanup.connect()) cleanup.execute("DELETE FROM score WHERE name LIKE 'load\\_%'");
+    return 0;
 }
\ No newline at end of file
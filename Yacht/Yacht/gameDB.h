@@ -6,6 +6,10 @@
 #include <sstream>
 #include <string>
 #include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
 #include <mysql.h>
 
 using namespace std;
@@ -16,22 +20,74 @@ struct ScoreEntry {
     int score;
 };
 
+struct DBPoolStats {
+    uint64_t checkouts = 0;
+    uint64_t waits = 0;         //    ٸ Ƚ
+    uint64_t opened = 0;
+    uint64_t discarded = 0;     // ܼ   
+    size_t open = 0;            //        
+};
+
+// MYSQL ڵ ϳ  尡 ÿ   Ƿ,  Ǯ    常  Ѵ.
+//  ʿ  maxConnections  ,    ¸ ݳ  ٸ
 class GameDB {
 private:
-    MYSQL* conn;
     string server;
     string user;
     string password;
     string database;
+    unsigned int port;          // 0 = ⺻ Ʈ
+    size_t maxConnections;
+    vector<MYSQL*> idle;
+    size_t openCount = 0;
+    DBPoolStats stats;
+    atomic<bool> logErrors{ true };     // Ǯ   尡   д´
+    mutable mutex mtx;
+    condition_variable available;
+
+    MYSQL* openConnection();
+    void release(MYSQL* conn, bool broken);
+    void reportError(const char* what, MYSQL* conn);
 
 public:
-    GameDB(const string& server, const string& user, const string& password, const string& database);
+    //  . Ҹϸ Ǯ ư,      ̸ ݴ´
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(GameDB* owner, MYSQL* conn) : owner(owner), conn(conn) {}
+        Lease(Lease&& o) noexcept : owner(o.owner), conn(o.conn), broken(o.broken) { o.conn = nullptr; }
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease() { if (conn) owner->release(conn, broken); }
+        MYSQL* get() const { return conn; }
+        explicit operator bool() const { return conn != nullptr; }
+        void checkAlive();          //   ڿ θ. ping  ϸ ݳ  
+    private:
+        GameDB* owner = nullptr;
+        MYSQL* conn = nullptr;
+        bool broken = false;
+    };
+
+    GameDB(const string& server, const string& user, const string& password, const string& database, size_t maxConnections = 4, unsigned int port = 0);
     ~GameDB();
 
-    bool connect();
-    void disconnect();
-    void recordScore(const string& name, int score);
+    bool connect();                 // ù     ȮѴ
+    void disconnect();              //  ִ   ݴ´ (   ݳ  ٽ Ǯ )
+    Lease acquire();                //      Lease
+    void setLogErrors(bool enabled);
+
+    bool recordScore(const string& name, int score);
+    bool recordScores(const vector<ScoreEntry>& entries);    //    Ʈǿ   INSERT  
     vector<ScoreEntry> getTopScores(int count);
+    bool getTopScores(int count, vector<ScoreEntry>& out);
+    bool execute(const string& sql);                       //    ϳ (غ/)
+    DBPoolStats poolStats() const;
 };
 
+// MariaDB/MySQL    (  +  ȸ)  Ŭ̾Ʈ 1..maxClients  ɾ
+// ó, p50/p99 ,  Ѵ ( --bench-db).  ͺ̽ yacht_load   .
+// host  "local" ̸ ӽ  ͸  Ʈ mariadbd/mysqld      (user/password ).
+// غ ῡ ϸ 1
+int runDBBenchmark(const string& host, const string& user, const string& password, int maxClients, int poolSize, int seconds);
+
 #endif // GAMEDB_H
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include "gameEndgame.h"
+#include "gameAI.h"
+#include "gameOdds.h"
+#include "gameReroll.h"
+#include "gameRules.h"
+#include "gameCache.h"
+#include "gameSim.h"
+#include "gameTrace.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+
+using namespace dicetab;
+
+// ===================  ===================
+//   ʽ    Ѵ:   ĭ ų ̹ 63 ̸̻ 63,
+//   ĭ  5 ä 63   ġ 64 (ʽ Ұ)
+constexpr int UPPER_DONE = 63;
+constexpr int UPPER_DEAD = 64;
+
+template <class R>
+static int upperKey(uint16_t open, int upper) {
+    static_assert(R::UPPER_BONUS_THRESHOLD <= UPPER_DONE, " հ Ű 6Ʈ ( 63 )");
+    const int openUpper = open & 0x3F;
+    if (!openUpper || upper >= R::UPPER_BONUS_THRESHOLD) return UPPER_DONE;
+    int maxGain = 0;
+    for (int f = 0; f < 6; ++f) if (openUpper >> f & 1) maxGain += 5 * (f + 1);
+    return upper + maxGain < R::UPPER_BONUS_THRESHOLD ? UPPER_DEAD : upper;
+}
+
+// [1][Ģ 1Ʈ][  1Ʈ][ Ű 7Ʈ][ ĭ 13Ʈ] (0   ʵ ֻ Ʈ Ҵ)
+template <class R>
+static uint32_t stateKey(uint16_t open, int ukey, bool yacht) {
+    return 1u << 31 | static_cast<uint32_t>(R::VARIANT == RulesVariant::YACHT) << 30 | static_cast<uint32_t>(yacht) << 29
+        | static_cast<uint32_t>(ukey) << 13 | open;
+}
+
+static DecisionCache g_endgameCache(1 << 16, 8);
+static atomic<bool> g_endgameEnabled{ true };
+static atomic<uint64_t> g_egDecisions{ 0 }, g_egSolved{ 0 }, g_egTotalNs{ 0 }, g_egMaxNs{ 0 };
+
+void setEndgameSolverEnabled(bool enabled) { g_endgameEnabled.store(enabled, memory_order_relaxed); }
+bool endgameSolverEnabled() { return g_endgameEnabled.load(memory_order_relaxed); }
+
+// ===================   ǥ ===================
+// F0[h] =  h    ĭ   (  + ʽ +   )
+// E1[k] = k      밪, F1[h] = max_{k  h} E1[k], E2[k] = k      밪
+struct TurnTables {
+    uint32_t key = 0;
+    double f0[HAND_COUNT];
+    uint8_t bestCat[HAND_COUNT];
+    double e1[KEEP_COUNT];
+    double f1[HAND_COUNT];
+    double e2[KEEP_COUNT];
+};
+
+template <class R>
+static double solveState(uint16_t open, int upper, bool yacht);
+
+template <class R>
+static void buildTurn(uint16_t open, int upper, bool yacht, TurnTables& t) {
+    const auto& table = rules::HAND_TABLE<R>;
+    const int T = R::UPPER_BONUS_THRESHOLD;
+    int cats[ENDGAME_MAX_OPEN], n = 0;
+    for (int c = 0; c < CAT_N && n < ENDGAME_MAX_OPEN; ++c) if (open >> c & 1) cats[n++] = c;
+
+    // ĭ      (   0~5,  ĭ 0/50  ° )
+    double next[ENDGAME_MAX_OPEN][6];
+    for (int i = 0; i < n; ++i) {
+        const int c = cats[i];
+        const uint16_t rest = static_cast<uint16_t>(open & ~(1u << c));
+        if (c < 6) {
+            for (int k = 0; k <= 5; ++k) {
+                const int s = k * (c + 1);
+                const int bonus = (upper < T && upper + s >= T) ? R::UPPER_BONUS : 0;
+                next[i][k] = bonus + solveState<R>(rest, (std::min)(T, upper + s), yacht);
+            }
+        }
+        else if (c == static_cast<int>(Category::YAHTZEE)) {
+            next[i][0] = solveState<R>(rest, upper, yacht);
+            next[i][1] = solveState<R>(rest, upper, true);
+        }
+        else {
+            next[i][0] = solveState<R>(rest, upper, yacht);
+        }
+    }
+
+    for (int h = 0; h < HAND_COUNT; ++h) {
+        const uint8_t* faces = table.faces[h].data();
+        int yachtFace = 0;
+        for (int f = 0; f < 6; ++f) if (faces[f] == 5) yachtFace = f + 1;
+        const bool joker = R::YACHT_BONUS_AND_JOKER && yacht && yachtFace;
+        double best = -1;
+        int bestC = cats[0];
+        for (int i = 0; i < n; ++i) {
+            const int c = cats[i];
+            int s = table.scores[h][c];
+            if (joker) {
+                const int dice[5] = { yachtFace, yachtFace, yachtFace, yachtFace, yachtFace };
+                s = rules::Kernel<R>::scoreWithJoker(static_cast<Category>(c), dice, true, !(open >> (yachtFace - 1) & 1));
+            }
+            double v = s;
+            if (c < 6) v += next[i][s / (c + 1)];
+            else if (c == static_cast<int>(Category::YAHTZEE)) v += next[i][R::YACHT_BONUS_AND_JOKER && s > 0];
+            else v += next[i][0];
+            if (v > best) { best = v; bestC = c; }
+        }
+        // ߸ 50     ߴ  ĭ ϵ +100
+        if (joker) best += YAHTZEE_BONUS_SCORE;
+        t.f0[h] = best;
+        t.bestCat[h] = static_cast<uint8_t>(bestC);
+    }
+
+    const RerollMatrix& mx = REROLL_MATRIX;
+    mx.expect(t.f0, t.e1);
+    RerollMatrix::bestKeep(t.e1, t.f1);
+    mx.expect(t.f1, t.e2);
+}
+
+template <class R>
+static double solveState(uint16_t open, int upper, bool yacht) {
+    if (!open) return 0.0;
+    if (!R::YACHT_BONUS_AND_JOKER) yacht = false;
+    const int ukey = upperKey<R>(open, upper);
+    //  Ű ´  Ƿ ǥ   Ǭ
+    upper = ukey == UPPER_DEAD ? 0 : ukey;
+    const uint32_t key = stateKey<R>(open, ukey, yacht);
+    uint32_t bits;
+    if (g_endgameCache.lookup(key, bits)) {
+        float v;
+        memcpy(&v, &bits, sizeof v);
+        return v;
+    }
+    TRACE_SCOPE("endgame.solveState", "ai");
+    TurnTables t;
+    buildTurn<R>(open, upper, yacht, t);
+    double f2[HAND_COUNT];
+    RerollMatrix::bestKeep(t.e2, f2);
+    const double value = REROLL_MATRIX.expect(0, f2);       // ƹ͵  ʰ ù 
+    const float v = static_cast<float>(value);
+    memcpy(&bits, &v, sizeof bits);
+    g_endgameCache.insert(key, bits);
+    g_egSolved.fetch_add(1, memory_order_relaxed);
+    return value;
+}
+
+// ===================  ===================
+struct EndgameState {
+    uint16_t open = 0;
+    int upper = 0;
+    bool yacht = false;
+};
+
+static EndgameState stateOf(const Scorecard& self) {
+    EndgameState s;
+    for (int c = 0; c < CAT_N; ++c) if (!self.used[c]) s.open |= static_cast<uint16_t>(1u << c);
+    s.upper = self.upperSum();              //  ̻/ Ұ upperKey  Ģ å ´
+    s.yacht = self.used[static_cast<int>(Category::YAHTZEE)] && self.scores[static_cast<int>(Category::YAHTZEE)] > 0;
+    return s;
+}
+
+static int popcount13(uint16_t v) {
+    int n = 0;
+    for (; v; v &= v - 1) ++n;
+    return n;
+}
+
+bool endgameApplies(const Scorecard& self) {
+    if (!endgameSolverEnabled()) return false;
+    const int open = popcount13(stateOf(self).open);
+    return open > 0 && open <= ENDGAME_MAX_OPEN;
+}
+
+//       ¸ Ƿ 帶   ǥ  д
+static const TurnTables& turnTables(const Scorecard& self) {
+    thread_local TurnTables cached;
+    const EndgameState s = stateOf(self);
+    rules::withRules(rulesVariant(), [&](auto r) {
+        using R = decltype(r);
+        const bool yacht = R::YACHT_BONUS_AND_JOKER && s.yacht;
+        const int ukey = upperKey<R>(s.open, s.upper);
+        const uint32_t key = stateKey<R>(s.open, ukey, yacht);
+        if (cached.key == key) return;
+        buildTurn<R>(s.open, ukey == UPPER_DEAD ? 0 : ukey, yacht, cached);
+        cached.key = key;
+    });
+    return cached;
+}
+
+static void recordDecision(chrono::steady_clock::time_point t0) {
+    const uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+    g_egDecisions.fetch_add(1, memory_order_relaxed);
+    g_egTotalNs.fetch_add(ns, memory_order_relaxed);
+    uint64_t prev = g_egMaxNs.load(memory_order_relaxed);
+    while (ns > prev && !g_egMaxNs.compare_exchange_weak(prev, ns, memory_order_relaxed)) {}
+}
+
+array<bool, 5> chooseHold_Endgame(const Dice& d, const Scorecard& self, int rollsLeft) {
+    TRACE_SCOPE("ai.endgameHold", "ai");
+    if (rollsLeft <= 0) return { true, true, true, true, true };
+    const auto t0 = chrono::steady_clock::now();
+    const TurnTables& t = turnTables(self);
+    const double* e = rollsLeft >= 2 ? t.e2 : t.e1;
+    const int h = handOf(d);
+    //    Ƿ   e[all]  ƴ϶  ϴ  F0 ̴
+    const int all = KEEP_BASE[5] + h;
+    int bestKeep = all;
+    double best = t.f0[h];
+    for (int i = 0; i < SUBKEEPS.count[h]; ++i) {
+        const int k = SUBKEEPS.keeps[h][i];
+        if (k != all && e[k] > best) { best = e[k]; bestKeep = k; }
+    }
+    array<bool, 5> held = bestKeep == all ? array<bool, 5>{ true, true, true, true, true } : holdMaskFor(d, KEEP_FACES[bestKeep]);
+    recordDecision(t0);
+    return held;
+}
+
+Category chooseCategory_Endgame(const Dice& d, const Scorecard& self) {
+    TRACE_SCOPE("ai.endgameCategory", "ai");
+    const auto t0 = chrono::steady_clock::now();
+    const Category c = static_cast<Category>(turnTables(self).bestCat[handOf(d)]);
+    recordDecision(t0);
+    return c;
+}
+
+double endgameExpectedGain(const Scorecard& self) {
+    const EndgameState s = stateOf(self);
+    if (popcount13(s.open) > ENDGAME_MAX_OPEN) return 0.0;
+    return rules::withRules(rulesVariant(), [&](auto r) { return solveState<decltype(r)>(s.open, s.upper, s.yacht); });
+}
+
+EndgameStats endgameStats() {
+    EndgameStats st;
+    st.decisions = g_egDecisions.load(memory_order_relaxed);
+    st.statesSolved = g_egSolved.load(memory_order_relaxed);
+    st.totalNs = g_egTotalNs.load(memory_order_relaxed);
+    st.maxNs = g_egMaxNs.load(memory_order_relaxed);
+    return st;
+}
+void resetEndgameStats() {
+    g_egDecisions.store(0, memory_order_relaxed);
+    g_egSolved.store(0, memory_order_relaxed);
+    g_egTotalNs.store(0, memory_order_relaxed);
+    g_egMaxNs.store(0, memory_order_relaxed);
+}
+
+// ===================  ===================
+void runEndgameBenchmark(int games, int threads) {
+    if (games < 1) games = 1;
+    if (threads < 1) threads = 1;
+    const RulesVariant saved = rulesVariant();
+    setRulesVariant(RulesVariant::YAHTZEE);
+
+    // 1) ˷ :  ϳ  23.33,  ϳ  50 x 4.60%
+    auto only = [](Category c, int upper, bool yacht) {
+        Scorecard sc;
+        for (int i = 0; i < CAT_N; ++i) sc.used[i] = i != static_cast<int>(c);
+        sc.upperTotal = upper;
+        if (yacht) sc.scores[static_cast<int>(Category::YAHTZEE)] = 50;
+        return endgameExpectedGain(sc);
+    };
+    cout << fixed << setprecision(3) << u8":  " << only(Category::CHANCE, 0, false) << u8" (23.333), ߸ "
+        << only(Category::YAHTZEE, 0, false) << u8" (2.300)" << endl;
+
+    // 2)  ĳÿ  ĭ 3  ϳ Ǫ ð (  )
+    g_endgameCache.clear();
+    resetEndgameStats();
+    Scorecard sc;
+    for (int i = 0; i < CAT_N; ++i) sc.used[i] = true;
+    for (Category c : { Category::SIXES, Category::FULL_HOUSE, Category::YAHTZEE }) sc.used[static_cast<int>(c)] = false;
+    sc.upperTotal = 45;
+    auto t0 = chrono::steady_clock::now();
+    const double v = endgameExpectedGain(sc);
+    const double coldMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    const uint64_t solved = endgameStats().statesSolved;
+    t0 = chrono::steady_clock::now();
+    Dice d{ 6, 6, 2, 3, 6 };
+    const array<bool, 5> held = chooseHold_Endgame(d, sc, 2);
+    const double holdUs = chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count();
+    cout << setprecision(2) << u8" ĭ 3 (Ľ/ǮϿ콺/,  45):  " << v << u8",  ĳ " << coldMs << " ms ("
+        << solved << u8" ), ù Ȧ  " << holdUs << " us, [6 6 2 3 6] ->";
+    for (int i = 0; i < 5; ++i) cout << (held[i] ? " *" : " .");
+    cout << endl;
+
+    // 3)  Ǯ  1    ( õ)
+    cout << setw(18) << left << u8"AI" << right << setw(14) << u8"Ǯ " << setw(14) << u8"Ǯ " << setw(10) << u8"" << endl;
+    for (AIDifficulty level : { AIDifficulty::NORMAL, AIDifficulty::HARD }) {
+        SimConfig cfg;
+        cfg.games = games;
+        cfg.threads = threads;
+        cfg.seats = { level };
+        cfg.seed = 77;
+        setEndgameSolverEnabled(false);
+        const SimResult off = runSimulation(cfg);
+        setEndgameSolverEnabled(true);
+        resetEndgameStats();
+        const SimResult on = runSimulation(cfg);
+        cout << setw(18) << left << string(difficultyName(level)) << right << setprecision(2)
+            << setw(14) << off.meanScore[0] << setw(14) << on.meanScore[0] << setw(10) << on.meanScore[0] - off.meanScore[0] << endl;
+    }
+    const EndgameStats st = endgameStats();
+    cout << setprecision(3) << u8"  " << st.decisions << u8"ȸ:  " << (st.decisions ? st.totalNs / 1e3 / st.decisions : 0.0)
+        << u8" us, ִ " << st.maxNs / 1e6 << u8" ms, ĳÿ  Ǭ  " << st.statesSolved << u8"" << endl;
+    setEndgameSolverEnabled(true);
+    setRulesVariant(saved);
+}
\ No newline at end of file
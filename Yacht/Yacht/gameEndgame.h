@@ -0,0 +1,39 @@
+#pragma once
+#ifndef GAMEENDGAME_H
+#define GAMEENDGAME_H
+
+#include <array>
+#include <cstdint>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// ===================  Ȯ Ǯ ===================
+//  ĭ ENDGAME_MAX_OPEN  ̸   ü  밪 Ǭ.
+//  = ( ĭ,  , ߸ 50 ߴ).  ʽ, Ʈ ʽ(+100) Ŀ ݿ "  " 밪 ִȭѴ.
+//   Ģ ĳϰ,    (Ȧ 2 + ĭ 1) 帶   ǥ Ѵ
+constexpr int ENDGAME_MAX_OPEN = 3;
+
+bool endgameApplies(const Scorecard& self);
+array<bool, 5> chooseHold_Endgame(const Dice& d, const Scorecard& self, int rollsLeft);
+Category chooseCategory_Endgame(const Dice& d, const Scorecard& self);
+//  ϱ  ¿    밪 (ʽ )
+double endgameExpectedGain(const Scorecard& self);
+
+void setEndgameSolverEnabled(bool enabled);
+bool endgameSolverEnabled();
+
+struct EndgameStats {
+    uint64_t decisions = 0;
+    uint64_t statesSolved = 0;      // ĳÿ   Ǭ  
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+};
+EndgameStats endgameStats();
+void resetEndgameStats();
+
+// ˷  ,  ð, / AI   Ǯ     ( --bench-endgame)
+void runEndgameBenchmark(int games, int threads);
+
+#endif // GAMEENDGAME_H
\ No newline at end of file
@@ -0,0 +1,279 @@
+#include "gameEnv.h"
+#include "gameRules.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <new>
+
+// =================== Ǻ  ===================
+static uint64_t splitMix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+static inline uint64_t nextRand(uint64_t& s) {
+    s ^= s >> 12;
+    s ^= s << 25;
+    s ^= s >> 27;
+    return s * 0x2545F4914F6CDD1Dull;
+}
+// xorshift64*   32Ʈ  1~6   ( )
+static inline int32_t rollDie(uint64_t& s) {
+    return static_cast<int32_t>(((nextRand(s) >> 32) * 6) >> 32) + 1;
+}
+
+// =================== ȯ ===================
+VecEnv::VecEnv(int numEnvs, uint64_t seed, RulesVariant rules)
+    : n(numEnvs), variant(rules), cards(static_cast<size_t>(numEnvs)),
+      dice(static_cast<size_t>(numEnvs) * 5), rollsLeft(numEnvs), round(numEnvs), rng(numEnvs) {
+    cards.reset(variant);
+    for (int i = 0; i < n; ++i) this->seed(i, seed + static_cast<uint64_t>(i));
+}
+
+void VecEnv::seed(int env, uint64_t seed) {
+    rng[env] = splitMix(seed) | 1;          // xorshift ´ 0 ̸  
+}
+
+void VecEnv::newGame(int i) {
+    cards.clear(i);
+    int32_t* d = &dice[static_cast<size_t>(i) * 5];
+    for (int k = 0; k < 5; ++k) d[k] = rollDie(rng[i]);
+    rollsLeft[i] = 2;
+    round[i] = 1;
+}
+
+void VecEnv::observe(int i, float* obs, uint64_t* legal) const {
+    float* o = obs + static_cast<size_t>(i) * ENV_OBS_DIM;
+    const int32_t* d = &dice[static_cast<size_t>(i) * 5];
+    const uint16_t used = cards.usedBits(i);
+    for (int k = 0; k < 5; ++k) o[k] = static_cast<float>(d[k]);
+    o[5] = rollsLeft[i];
+    o[6] = round[i];
+    for (int c = 0; c < ScorecardBatch::CAT_N; ++c) o[7 + c] = static_cast<float>((used >> c) & 1);
+    o[20] = static_cast<float>(cards.upperSum(i));
+    o[21] = static_cast<float>(cards.used(i, Category::YAHTZEE) && cards.score(i, Category::YAHTZEE) > 0);
+    o[22] = static_cast<float>(cards.yahtzeeBonusCount(i));
+    o[23] = static_cast<float>(cards.total(i));
+    if (legal) {
+        const uint64_t open = static_cast<uint64_t>(~used & ((1u << ScorecardBatch::CAT_N) - 1));
+        legal[i] = (open << ENV_HOLD_ACTIONS) | (rollsLeft[i] ? 0xFFFFFFFFull : 0);
+    }
+}
+
+void VecEnv::reset(float* obs, uint64_t* legal) {
+    cards.reset(variant);
+    for (int i = 0; i < n; ++i) {
+        newGame(i);
+        observe(i, obs, legal);
+    }
+}
+
+template <class R>
+void VecEnv::stepImpl(const int32_t* actions, float* obs, float* reward, uint8_t* done, uint64_t* legal) {
+    using K = rules::Kernel<R>;
+    const int yachtIdx = static_cast<int>(Category::YAHTZEE);
+    for (int i = 0; i < n; ++i) {
+        int32_t* d = &dice[static_cast<size_t>(i) * 5];
+        const int32_t a = actions[i];
+        const uint16_t used = cards.usedBits(i);
+        reward[i] = 0;
+        done[i] = 0;
+
+        if (a >= 0 && a < ENV_HOLD_ACTIONS && rollsLeft[i]) {
+            for (int k = 0; k < 5; ++k) if (!((a >> k) & 1)) d[k] = rollDie(rng[i]);
+            rollsLeft[i]--;
+        }
+        else {
+            int c = a - ENV_HOLD_ACTIONS;
+            if (c < 0 || c >= ScorecardBatch::CAT_N || ((used >> c) & 1)) {
+                envStats.invalidActions++;
+                c = 0;
+                while ((used >> c) & 1) ++c;
+            }
+            const bool yachtScored = ((used >> yachtIdx) & 1) && cards.score(i, Category::YAHTZEE) > 0;
+            const int before = cards.total(i);
+            cards.setScore(i, static_cast<Category>(c), K::scoreWithJoker(static_cast<Category>(c), d, yachtScored, (used >> (d[0] - 1)) & 1));
+            if constexpr (R::YACHT_BONUS_AND_JOKER) {
+                if (yachtScored && K::score(Category::YAHTZEE, d)) cards.addYahtzeeBonus(i);
+            }
+            const int after = cards.total(i);
+            reward[i] = static_cast<float>(after - before);
+
+            if (round[i] == K::activeCount()) {
+                done[i] = 1;
+                envStats.episodes++;
+                envStats.scoreSum += after;
+                newGame(i);
+            }
+            else {
+                round[i]++;
+                for (int k = 0; k < 5; ++k) d[k] = rollDie(rng[i]);
+                rollsLeft[i] = 2;
+            }
+        }
+        observe(i, obs, legal);
+    }
+    envStats.steps += static_cast<uint64_t>(n);
+}
+
+void VecEnv::step(const int32_t* actions, float* obs, float* reward, uint8_t* done, uint64_t* legal) {
+    rules::withRules(variant, [&](auto r) { stepImpl<decltype(r)>(actions, obs, reward, done, legal); });
+}
+
+// =================== C API ===================
+YACHT_API VecEnv* yacht_env_create(int32_t numEnvs, uint64_t seed, int32_t rules) {
+    if (numEnvs < 1 || rules < 0 || rules >= static_cast<int32_t>(RulesVariant::COUNT)) return nullptr;
+    try {
+        return new VecEnv(numEnvs, seed, static_cast<RulesVariant>(rules));
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+YACHT_API void yacht_env_destroy(VecEnv* env) { delete env; }
+YACHT_API int32_t yacht_env_obs_dim() { return ENV_OBS_DIM; }
+YACHT_API int32_t yacht_env_action_count() { return ENV_ACTIONS; }
+YACHT_API int32_t yacht_env_reset(VecEnv* env, float* obs, uint64_t* legal) {
+    if (!env || !obs) return -1;
+    env->reset(obs, legal);
+    return 0;
+}
+YACHT_API int32_t yacht_env_step(VecEnv* env, const int32_t* actions, float* obs, float* reward, uint8_t* done, uint64_t* legal) {
+    if (!env || !actions || !obs || !reward || !done) return -1;
+    env->step(actions, obs, reward, done, legal);
+    return 0;
+}
+YACHT_API int32_t yacht_env_seed(VecEnv* env, int32_t index, uint64_t seed) {
+    if (!env || index < 0 || index >= env->size()) return -1;
+    env->seed(index, seed);
+    return 0;
+}
+
+// ===================  ġ ˻ ===================
+// VecEnv  Ǹ Scorecard ϳ  Ѵ.  ൿ̸   ֻ [0..4] 
+//  ĭ(   ൿ̸ ȯ   ִ ù ĭ) applyScore  ҷ , ,   θ Ѵ.
+// ൿ     Ǵ  Ȧ, Ʈ  Ʈ ĭ 켱(Ʈ ʽ/Ŀ ΰ  ),
+//  ۿ  ִ ĭ /  ƹ ĭ(̹ ä ĭ̸ ü Ģ Ȯ). ȯ = ġ 
+static uint64_t checkEnvParity(RulesVariant rules, int envs, int games, uint64_t& bonuses) {
+    const RulesVariant saved = rulesVariant();
+    setRulesVariant(rules);                 // applyScore/Scorecard   Ģ 
+    VecEnv env(envs, 2024, rules);
+    vector<Scorecard> cards(envs);
+    for (auto& sc : cards) sc.clearScores();
+    vector<float> obs(static_cast<size_t>(envs) * ENV_OBS_DIM), reward(envs);
+    vector<uint8_t> done(envs);
+    vector<uint64_t> legal(envs);
+    vector<int32_t> actions(envs);
+    vector<int> expectReward(envs), expectTotal(envs);
+    vector<uint8_t> expectDone(envs);
+    uint64_t policyRng = splitMix(99) | 1;
+    uint64_t mismatches = 0;
+    int finished = 0;
+    env.reset(obs.data(), legal.data());
+
+    while (finished < games) {
+        for (int i = 0; i < envs; ++i) {
+            const uint64_t x = nextRand(policyRng);
+            const float* o = &obs[static_cast<size_t>(i) * ENV_OBS_DIM];
+            Scorecard& sc = cards[i];
+            Dice d;
+            for (int k = 0; k < 5; ++k) d[k] = static_cast<int>(o[k]);
+            const array<int, 7> cnt = countFace(d);
+            int face = 1;
+            for (int f = 2; f <= 6; ++f) if (cnt[f] >= cnt[face]) face = f;
+            if ((legal[i] & 1) && (x & 3) && cnt[face] < 5) {
+                int keep = 0;
+                for (int k = 0; k < 5; ++k) keep |= (d[k] == face) << k;
+                actions[i] = static_cast<int32_t>((x & 4) ? keep : (x >> 8) & 31);
+                expectReward[i] = 0;
+                expectTotal[i] = sc.total();
+                expectDone[i] = 0;
+                continue;
+            }
+            const uint64_t open = legal[i] >> ENV_HOLD_ACTIONS;
+            int c = static_cast<int>((x >> 32) % ScorecardBatch::CAT_N);
+            if (cnt[face] == 5 && (open >> static_cast<int>(Category::YAHTZEE) & 1)) c = static_cast<int>(Category::YAHTZEE);
+            else if ((x >> 16 & 15) != 0) while (!((open >> c) & 1)) c = (c + 1) % ScorecardBatch::CAT_N;
+            actions[i] = ENV_HOLD_ACTIONS + c;
+            if (sc.used[c]) { c = 0; while (sc.used[c]) ++c; }
+            const int before = sc.total(), bonusBefore = sc.yahtzeeBonusCount;
+            applyScore(sc, static_cast<Category>(c), d);
+            bonuses += static_cast<uint64_t>(sc.yahtzeeBonusCount - bonusBefore);
+            expectReward[i] = sc.total() - before;
+            expectTotal[i] = sc.total();
+            expectDone[i] = all_of(sc.used.begin(), sc.used.end(), [](bool u) { return u; });
+        }
+        env.step(actions.data(), obs.data(), reward.data(), done.data(), legal.data());
+        for (int i = 0; i < envs; ++i) {
+            const float* o = &obs[static_cast<size_t>(i) * ENV_OBS_DIM];
+            //   ̹   Ƿ     Ȯ   
+            const int envTotal = done[i] ? expectTotal[i] - expectReward[i] + static_cast<int>(reward[i]) : static_cast<int>(o[23]);
+            if (static_cast<int>(reward[i]) != expectReward[i] || envTotal != expectTotal[i] || done[i] != expectDone[i]) {
+                if (mismatches < 5)
+                    cerr << u8"ġ:  " << i << u8" ൿ " << actions[i] << u8"  " << reward[i] << "/" << expectReward[i]
+                         << u8"  " << envTotal << "/" << expectTotal[i] << u8"  " << int(done[i]) << "/" << int(expectDone[i]) << endl;
+                mismatches++;
+            }
+            if (expectDone[i]) {
+                finished++;
+                cards[i].clearScores();
+            }
+        }
+    }
+    setRulesVariant(saved);
+    return mismatches;
+}
+
+// =================== ġũ ===================
+// å:     Ȧ, ƴϸ  ִ ĭ  . å ð  
+int runEnvBenchmark(int maxEnvs, int seconds) {
+    if (maxEnvs < 1) maxEnvs = 1;
+    if (seconds < 1) seconds = 1;
+    constexpr int PARITY_GAMES = 50000;
+    uint64_t mismatches = 0, bonuses = 0;
+    for (RulesVariant v : { RulesVariant::YAHTZEE, RulesVariant::YACHT }) mismatches += checkEnvParity(v, 256, PARITY_GAMES, bonuses);
+    cout << u8" ġ ˻ (applyScore , Ģ " << PARITY_GAMES << u8", Ʈ ʽ " << bonuses << u8"ȸ): ġ "
+         << mismatches << endl;
+    if (mismatches) return 1;
+
+    vector<int> sizes;
+    for (int e : { 1, 64, 1024 }) if (e < maxEnvs) sizes.push_back(e);
+    sizes.push_back(maxEnvs);
+
+    cout << setw(10) << u8"ȯ " << setw(14) << "Msteps/s" << setw(14) << "games/s" << setw(12) << u8" " << endl;
+    for (int envs : sizes) {
+        VecEnv env(envs, 1, rulesVariant());
+        vector<float> obs(static_cast<size_t>(envs) * ENV_OBS_DIM), reward(envs);
+        vector<uint8_t> done(envs);
+        vector<uint64_t> legal(envs);
+        vector<int32_t> actions(envs);
+        uint64_t policyRng = splitMix(42) | 1;
+        env.reset(obs.data(), legal.data());
+
+        auto t0 = chrono::steady_clock::now();
+        double elapsed = 0;
+        while (elapsed < seconds) {
+            for (int r = 0; r < 64; ++r) {
+                for (int i = 0; i < envs; ++i) {
+                    const uint64_t x = nextRand(policyRng);
+                    if (legal[i] & 1) { actions[i] = static_cast<int32_t>(x & 31); continue; }
+                    const uint64_t open = legal[i] >> ENV_HOLD_ACTIONS;
+                    int c = static_cast<int>((x >> 32) % ScorecardBatch::CAT_N);
+                    while (!((open >> c) & 1)) c = (c + 1) % ScorecardBatch::CAT_N;
+                    actions[i] = ENV_HOLD_ACTIONS + c;
+                }
+                env.step(actions.data(), obs.data(), reward.data(), done.data(), legal.data());
+            }
+            elapsed = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        }
+        const EnvStats& s = env.stats();
+        cout << setw(10) << envs << fixed << setprecision(2) << setw(14) << s.steps / elapsed / 1e6
+            << setprecision(0) << setw(14) << s.episodes / elapsed
+            << setprecision(1) << setw(12) << (s.episodes ? static_cast<double>(s.scoreSum) / s.episodes : 0.0) << endl;
+    }
+    return 0;
+}
\ No newline at end of file
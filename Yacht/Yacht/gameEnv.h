@@ -0,0 +1,87 @@
+#pragma once
+#ifndef GAMEENV_H
+#define GAMEENV_H
+
+#include <cstdint>
+#include <vector>
+
+#include "gameLogic.h"
+#include "gameBatch.h"
+
+using namespace std;
+
+// =================== н  ȯ ===================
+//   1  numEnvs    step  Բ Ѵ (   ڷ  )
+//  ൿ(Ǹ int32): 0~31 =  ֻ Ʈ ũ(bit i = i ֻ) ٽ , 32+c = ĭ c  
+//  Ģ    ൿ( µ ٽ , ̹ ä ĭ)  ִ ù ĭ   óѴ
+//  (Ǹ float ENV_OBS_DIM ):
+//   [0..4] ֻ   [5]    [6]   [7..19] ĭ    [20]  
+//   [21]  50  (Ŀ/ʽ )  [22] Ʈ ʽ   [23]  
+//   = ̹ ൿ þ  (ʽ ).     =  
+//    done = 1  ְ   ٷ   ٽ Ѵ (   ù )
+//   Ǹ  ־  õ  ൿ̸  /    ´
+constexpr int ENV_OBS_DIM = 24;
+constexpr int ENV_HOLD_ACTIONS = 32;
+constexpr int ENV_ACTIONS = ENV_HOLD_ACTIONS + static_cast<int>(Category::CATEGORY_COUNT);
+
+struct EnvStats {
+    uint64_t steps = 0;             //    
+    uint64_t episodes = 0;
+    uint64_t invalidActions = 0;
+    int64_t scoreSum = 0;           //     
+};
+
+class VecEnv {
+public:
+    VecEnv(int numEnvs, uint64_t seed, RulesVariant rules);
+    int size() const { return n; }
+    RulesVariant rules() const { return variant; }
+
+    // ۴ ȣڰ ̸    迭: obs[size * ENV_OBS_DIM], reward[size], done[size], legal[size]
+    // legal[i]  bit a = ൿ a  (nullptr ̸  )
+    void reset(float* obs, uint64_t* legal);
+    void step(const int32_t* actions, float* obs, float* reward, uint8_t* done, uint64_t* legal);
+    void seed(int env, uint64_t seed);      //    ٽ  ( reset Ǵ ڵ ۺ )
+    const EnvStats& stats() const { return envStats; }
+
+private:
+    int n;
+    RulesVariant variant;
+    ScorecardBatch cards;
+    vector<int32_t> dice;                   // [n * 5]
+    vector<uint8_t> rollsLeft;
+    vector<uint8_t> round;
+    vector<uint64_t> rng;                   // Ǻ xorshift64* 
+    EnvStats envStats;
+
+    void newGame(int i);
+    void observe(int i, float* obs, uint64_t* legal) const;
+    template <class R> void stepImpl(const int32_t* actions, float* obs, float* reward, uint8_t* done, uint64_t* legal);
+};
+
+// Scorecard/applyScore   ġ ˻( Ģ)  ȯ   ʴ step  ( ൿ,  .
+//  --bench-env). ġ    1  ȯ
+int runEnvBenchmark(int maxEnvs, int seconds);
+
+// =================== C API (FFI ) ===================
+// н ڵ(Python ctypes/cffi ) θ  ֵ ̸   .
+// ַ YachtEnv Ʈ gameEnv/gameBatch/gameLogic  ҽ yacht_env.dll  Ƿ ٸ ⿡  ʴ´
+// ܴ 踦  ʴ´ (  = nullptr). reset/step/seed  0 = , -1 = env  ʼ ۰ nullptr
+// (Ǵ seed  index   ). legal  nullptr ̾ ȴ
+#ifndef YACHT_API
+#ifdef _WIN32
+#define YACHT_API extern "C" __declspec(dllexport)
+#else
+#define YACHT_API extern "C" __attribute__((visibility("default")))
+#endif
+#endif
+
+YACHT_API VecEnv* yacht_env_create(int32_t numEnvs, uint64_t seed, int32_t rules);   // rules: 0 = , 1 = Ʈ
+YACHT_API void yacht_env_destroy(VecEnv* env);
+YACHT_API int32_t yacht_env_obs_dim();
+YACHT_API int32_t yacht_env_action_count();
+YACHT_API int32_t yacht_env_reset(VecEnv* env, float* obs, uint64_t* legal);
+YACHT_API int32_t yacht_env_step(VecEnv* env, const int32_t* actions, float* obs, float* reward, uint8_t* done, uint64_t* legal);
+YACHT_API int32_t yacht_env_seed(VecEnv* env, int32_t index, uint64_t seed);
+
+#endif // GAMEENV_H
\ No newline at end of file
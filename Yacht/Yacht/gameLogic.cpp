@@ -1,4 +1,7 @@
 #include "gameLogic.h"
+#include "gameRules.h"
+
+#include <atomic>
 
 // ===================    ===================
 const array<string, static_cast<size_t>(Category::CATEGORY_COUNT)> CAT_NAME = {
@@ -7,27 +10,57 @@ const array<string, static_cast<size_t>(Category::CATEGORY_COUNT)> CAT_NAME = {
     u8" ƮƮ", u8" ƮƮ", u8"", u8""
 };
 
-mt19937 g_rng(random_device{}());
-uniform_int_distribution<int> g_diceDist(1, 6);
+static const array<string, static_cast<size_t>(Category::CATEGORY_COUNT)> YACHT_CAT_NAME = {
+    u8"̽(1)", u8"(2)", u8"(3)", u8"(4)", u8"̺(5)", u8"Ľ(6)",
+    u8"()", u8"īε", u8"ǮϿ콺",
+    u8" ƮƮ", u8" ƮƮ", u8"Ʈ", u8"̽"
+};
+static atomic<uint8_t> g_rulesVariant{ static_cast<uint8_t>(RulesVariant::YAHTZEE) };
 
-// =================== ü ޼  ===================
-Scorecard::Scorecard(string n) : name(move(n)) {
-    scores.fill(0); used.fill(false);
+thread_local mt19937 g_rng(random_device{}());
+thread_local uniform_int_distribution<int> g_diceDist(1, 6);
+
+void seedRng(uint64_t seed) {
+    seed_seq seq{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) };
+    g_rng.seed(seq);
 }
-int Scorecard::upperSum() const {
-    int s = 0;
-    for (int i = 0; i <= static_cast<int>(Category::SIXES); i++) if (used[i]) s += scores[i];
-    return s;
+
+// =================== Ģ  ===================
+void setRulesVariant(RulesVariant v) { g_rulesVariant.store(static_cast<uint8_t>(v), memory_order_relaxed); }
+RulesVariant rulesVariant() { return static_cast<RulesVariant>(g_rulesVariant.load(memory_order_relaxed)); }
+string_view rulesName(RulesVariant v) { return v == RulesVariant::YACHT ? u8"Ʈ (ŬϿ콺)" : u8" (Yahtzee)"; }
+bool categoryActive(Category cat) {
+    return rules::withRules(rulesVariant(), [&](auto r) { return rules::Kernel<decltype(r)>::active(cat); });
+}
+int activeCategoryCount() { return activeCategoryCount(rulesVariant()); }
+int activeCategoryCount(RulesVariant v) {
+    return rules::withRules(v, [](auto r) { return rules::Kernel<decltype(r)>::activeCount(); });
+}
+string_view categoryName(Category cat) { return categoryName(cat, rulesVariant()); }
+string_view categoryName(Category cat, RulesVariant v) {
+    return (v == RulesVariant::YACHT ? YACHT_CAT_NAME : CAT_NAME)[static_cast<int>(cat)];
+}
+
+// =================== ü ޼  ===================
+Scorecard::Scorecard(string n) : name(move(n)) { clearScores(); }
+void Scorecard::clearScores() {
+    scores.fill(0);
+    for (int i = 0; i < static_cast<int>(Category::CATEGORY_COUNT); i++) used[i] = !categoryActive(static_cast<Category>(i));
+    yahtzeeBonusCount = 0;
+    upperTotal = lowerTotal = 0;
 }
-int Scorecard::lowerSum() const {
-    int s = 0;
-    for (int i = static_cast<int>(Category::THREE_KIND); i <= static_cast<int>(Category::CHANCE); i++) if (used[i]) s += scores[i];
-    return s;
+void Scorecard::setScore(Category cat, int score) {
+    const int c = static_cast<int>(cat);
+    int& sum = (c <= static_cast<int>(Category::SIXES)) ? upperTotal : lowerTotal;
+    sum += score - (used[c] ? scores[c] : 0);
+    scores[c] = score;
+    used[c] = true;
 }
-int Scorecard::upperBonus() const {
-    return (upperSum() >= UPPER_BONUS_THRESHOLD) ? UPPER_BONUS_SCORE : 0;
+void Scorecard::recomputeTotals() {
+    upperTotal = lowerTotal = 0;
+    for (int i = 0; i <= static_cast<int>(Category::SIXES); i++) if (used[i]) upperTotal += scores[i];
+    for (int i = static_cast<int>(Category::THREE_KIND); i <= static_cast<int>(Category::CHANCE); i++) if (used[i]) lowerTotal += scores[i];
 }
-int Scorecard::total() const { return upperSum() + upperBonus() + lowerSum() + (yahtzeeBonusCount * YAHTZEE_BONUS_SCORE); }
 
 // ===================     Լ ===================
 int sumDice(const Dice& d) { return accumulate(d.begin(), d.end(), 0); }
@@ -51,39 +84,48 @@ int scoreFullHouse(const Dice& d) {
     for (int i = 1; i <= 6; i++) { if (c[i] == 3) h3 = true; if (c[i] == 2) h2 = true; }
     return (h3 && h2) ? FULL_HOUSE_SCORE : 0;
 }
-int longestRun(const set<int>& s) {
-    if (s.empty()) return 0;
-    int best = 1, cur = 1, prev = *s.begin();
-    for (auto it = next(s.begin()); it != s.end(); ++it) {
-        if (*it == prev + 1) cur++; else cur = 1;
+//   Ʈũ(bit f =  f)    . ƮƮ  set   ʴ´
+static int longestRun(int faceMask) {
+    int best = 0, cur = 0;
+    for (int f = 1; f <= 6; f++) {
+        cur = (faceMask >> f & 1) ? cur + 1 : 0;
         best = (std::max)(best, cur);
-        prev = *it;
     }
     return best;
 }
-int scoreSmallStraight(const Dice& d) { set<int> s(d.begin(), d.end()); return (longestRun(s) >= 4) ? SMALL_STRAIGHT_SCORE : 0; }
-int scoreLargeStraight(const Dice& d) { set<int> s(d.begin(), d.end()); return (longestRun(s) >= 5) ? LARGE_STRAIGHT_SCORE : 0; }
+static int faceMask(const Dice& d) { int m = 0; for (int v : d) m |= 1 << v; return m; }
+int scoreSmallStraight(const Dice& d) { return (longestRun(faceMask(d)) >= 4) ? SMALL_STRAIGHT_SCORE : 0; }
+int scoreLargeStraight(const Dice& d) { return (longestRun(faceMask(d)) >= 5) ? LARGE_STRAIGHT_SCORE : 0; }
 int scoreYahtzee(const Dice& d) { return isYahtzee(d) ? YAHTZEE_SCORE : 0; }
 int scoreChance(const Dice& d) { return sumDice(d); }
+//    Ģ å Ŀη (Ģ б ⼭  )
+int upperBonusFor(int upperSum) {
+    return rules::withRules(rulesVariant(), [&](auto r) { return rules::Kernel<decltype(r)>::upperBonus(upperSum); });
+}
 int scoreCategory(Category cat, const Dice& d) {
-    switch (cat) {
-    case Category::ONES: return scoreUpper(d, 1);
-    case Category::TWOS: return scoreUpper(d, 2);
-    case Category::THREES: return scoreUpper(d, 3);
-    case Category::FOURS: return scoreUpper(d, 4);
-    case Category::FIVES: return scoreUpper(d, 5);
-    case Category::SIXES: return scoreUpper(d, 6);
-    case Category::THREE_KIND: return scoreThreeKind(d);
-    case Category::FOUR_KIND: return scoreFourKind(d);
-    case Category::FULL_HOUSE: return scoreFullHouse(d);
-    case Category::SMALL_STRAIGHT: return scoreSmallStraight(d);
-    case Category::LARGE_STRAIGHT: return scoreLargeStraight(d);
-    case Category::YAHTZEE: return scoreYahtzee(d);
-    case Category::CHANCE: return scoreChance(d);
-    default: return 0;
-    }
+    return rules::withRules(rulesVariant(), [&](auto r) { return rules::Kernel<decltype(r)>::score(cat, d.data()); });
+}
+// Ʈ ʽ  Ŀ Ģ ݿ  (̸/ ). Ʈ Ģ Ŀ 
+int scoreWithJoker(Category cat, const Dice& d, const Scorecard& sc) {
+    const bool yachtScored = sc.used[static_cast<int>(Category::YAHTZEE)] && sc.scores[static_cast<int>(Category::YAHTZEE)] > 0;
+    return rules::withRules(rulesVariant(), [&](auto r) {
+        return rules::Kernel<decltype(r)>::scoreWithJoker(cat, d.data(), yachtScored, sc.used[d[0] - 1]);
+    });
+}
+// īװ  ϰ Ʈ ʽ   ϵ  ȯ
+int applyScore(Scorecard& sc, Category cat, const Dice& d) {
+    bool hadYahtzeeScored =
+        sc.used[static_cast<int>(Category::YAHTZEE)] &&
+        sc.scores[static_cast<int>(Category::YAHTZEE)] > 0;
+
+    int score = scoreWithJoker(cat, d, sc);
+    sc.setScore(cat, score);
+
+    const bool bonus = rules::withRules(rulesVariant(), [](auto r) { return decltype(r)::YACHT_BONUS_AND_JOKER; });
+    if (bonus && isYahtzee(d) && hadYahtzeeScored) sc.yahtzeeBonusCount++;
+    return score;
 }
-inline int roll6() { return g_diceDist(g_rng); }
+int roll6() { return g_diceDist(g_rng); }
 vector<int> parseIndices(string line) {
     for (char& ch : line) if (ch == ',') ch = ' ';
     vector<int> idx; istringstream iss(line); int x;
@@ -91,24 +133,26 @@ vector<int> parseIndices(string line) {
     sort(idx.begin(), idx.end()); idx.erase(unique(idx.begin(), idx.end()), idx.end());
     return idx;
 }
-vector<int> generateDiceSequence(int totalFrames, int maxRepeat) {
-    vector<int> sequence;
-    int framesLeft = totalFrames;
-    while (framesLeft > 0) {
+void generateDiceSequence(int* out, int totalFrames, int maxRepeat) {
+    int pos = 0;
+    while (pos < totalFrames) {
         int repeat = (g_rng() % maxRepeat) + 1;
-        if (repeat > framesLeft) repeat = framesLeft;
+        if (repeat > totalFrames - pos) repeat = totalFrames - pos;
         int face = roll6();
-        for (int i = 0; i < repeat; ++i) sequence.push_back(face);
-        framesLeft -= repeat;
+        for (int i = 0; i < repeat; ++i) out[pos++] = face;
     }
+}
+vector<int> generateDiceSequence(int totalFrames, int maxRepeat) {
+    vector<int> sequence(totalFrames);
+    generateDiceSequence(sequence.data(), totalFrames, maxRepeat);
     return sequence;
 }
-string checkForSpecialCombinations(const Dice& d) {
-    if (scoreYahtzee(d) > 0) return u8"!";
+string_view checkForSpecialCombinations(const Dice& d) {
+    if (scoreYahtzee(d) > 0) return rulesVariant() == RulesVariant::YACHT ? u8"Ʈ!" : u8"!";
     if (scoreLargeStraight(d) > 0) return u8" ƮƮ!";
     if (scoreSmallStraight(d) > 0) return u8" ƮƮ!";
     if (scoreFullHouse(d) > 0) return u8"ǮϿ콺!";
     if (scoreFourKind(d) > 0) return u8"īε!";
-    if (scoreThreeKind(d) > 0) return u8"īε!";
-    return "";
+    if (categoryActive(Category::THREE_KIND) && scoreThreeKind(d) > 0) return u8"īε!";
+    return {};
 }
\ No newline at end of file
@@ -5,11 +5,12 @@
 #include <string>
 #include <vector>
 #include <array>
-#include <set>
+#include <string_view>
 #include <numeric>
 #include <algorithm>
 #include <sstream>
 #include <random>
+#include <cstdint>
 
 using namespace std;
 
@@ -20,8 +21,6 @@ constexpr int SMALL_STRAIGHT_SCORE = 30;
 constexpr int LARGE_STRAIGHT_SCORE = 40;
 constexpr int YAHTZEE_SCORE = 50;
 constexpr int YAHTZEE_BONUS_SCORE = 100;
-constexpr int UPPER_BONUS_THRESHOLD = 63;
-constexpr int UPPER_BONUS_SCORE = 35;
 
 enum class Category {
     ONES, TWOS, THREES, FOURS, FIVES, SIXES,
@@ -32,24 +31,47 @@ enum class Category {
 
 extern const array<string, static_cast<size_t>(Category::CATEGORY_COUNT)> CAT_NAME;
 
+// Ģ . Category   Ģ (13ĭ)̰, Ģ  ĭ    0  óȴ.
+//  Ģ ü gameRules.h  å ü ִ
+enum class RulesVariant : uint8_t { YAHTZEE, YACHT, COUNT };
+void setRulesVariant(RulesVariant v);
+RulesVariant rulesVariant();
+string_view rulesName(RulesVariant v);
+bool categoryActive(Category cat);
+int activeCategoryCount();                  //   
+int activeCategoryCount(RulesVariant v);
+string_view categoryName(Category cat);     //  Ģ ̸ (Ʈ:  -> ̽,  -> Ʈ)
+string_view categoryName(Category cat, RulesVariant v);
+int upperBonusFor(int upperSum);            //  Ģ  ʽ (/ gameRules.h å)
+
 using Dice = array<int, 5>;
 
-extern mt19937 g_rng;
-extern uniform_int_distribution<int> g_diceDist;
+// 帶    ( /ùķ̼    )
+extern thread_local mt19937 g_rng;
+extern thread_local uniform_int_distribution<int> g_diceDist;
+// 64Ʈ õ ü(/ 32Ʈ) g_rng  ʱȭѴ. ÷  seed    
+void seedRng(uint64_t seed);
 
 // =================== ü  ===================
 
+// ĭ setScore  ä. /Ʒ հ踦 ׶ Բ ϹǷ հ ȸ O(1)
+// scores/used   ģ ( /Ʈũ ) recomputeTotals  ҷ Ѵ
 struct Scorecard {
     string name;
     array<int, static_cast<size_t>(Category::CATEGORY_COUNT)> scores{};
     array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)> used{};
     int yahtzeeBonusCount = 0;
+    int upperTotal = 0;
+    int lowerTotal = 0;
 
     Scorecard(string n = u8"÷̾");
-    int upperSum() const;
-    int lowerSum() const;
-    int upperBonus() const;
-    int total() const;
+    void setScore(Category cat, int score);
+    void clearScores();                     //   (Ģ  ʴ ĭ  ó)
+    void recomputeTotals();
+    int upperSum() const { return upperTotal; }
+    int lowerSum() const { return lowerTotal; }
+    int upperBonus() const { return upperBonusFor(upperTotal); }
+    int total() const { return upperTotal + upperBonus() + lowerTotal + (yahtzeeBonusCount * YAHTZEE_BONUS_SCORE); }
 };
 
 // =================== Լ  ===================
@@ -67,9 +89,249 @@ int scoreLargeStraight(const Dice& d);
 int scoreYahtzee(const Dice& d);
 int scoreChance(const Dice& d);
 int scoreCategory(Category cat, const Dice& d);
-inline int roll6();
+int scoreWithJoker(Category cat, const Dice& d, const Scorecard& sc);
+int applyScore(Scorecard& sc, Category cat, const Dice& d);
+int roll6();
 vector<int> parseIndices(string line);
 vector<int> generateDiceSequence(int totalFrames = 20, int maxRepeat = 4);
-string checkForSpecialCombinations(const Dice& d);
+void generateDiceSequence(int* out, int totalFrames, int maxRepeat);     // out  totalFrames  ä (Ҵ )
+string_view checkForSpecialCombinations(const Dice& d);                  // ش   ڿ
+
+// ===================  Ÿ  ǥ ===================
+//  / ֻ /ٽ   Ȯ   ð  (  0, constexpr   ).
+// ֻ n(0~5)    ĵ  a_0 <= ... <= a_{n-1} (0~5)  
+// ռ ü rank = sum C(a_i + i, i + 1)  ȣ ű. n   KEEP_BASE[n] ̸,
+// ֻ 5 (hand) ȣ n = 5   rank  .
+//  Լ std::array  operator[]  data() ͷ Ѵ (Ϸ  򰡰   ).
+namespace dicetab {
+
+constexpr int HAND_COUNT = 252;         // C(10, 5)
+constexpr int KEEP_COUNT = 462;         // sum_{n=0..5} C(n + 5, 5)
+constexpr int OUTCOME_COUNT = 4368;     // sum_n C(n + 5, 5) * C(10 - n, 5)
+constexpr int MAX_SUBKEEPS = 32;
+constexpr int CAT_N = static_cast<int>(Category::CATEGORY_COUNT);
+
+using FaceCounts = array<uint8_t, 6>;   // [0] = 1  ... [5] = 6 
+
+constexpr int binom(int n, int k) {
+    if (k < 0 || k > n) return 0;
+    int r = 1;
+    for (int i = 1; i <= k; ++i) r = r * (n - k + i) / i;
+    return r;
+}
+constexpr int KEEP_BASE[7] = { 0, 1, 7, 28, 84, 210, 462 };
+constexpr int FACTORIAL[6] = { 1, 1, 2, 6, 24, 120 };
+constexpr int POW6[6] = { 1, 6, 36, 216, 1296, 7776 };
+// rank  C(f + i, i + 1)
+struct RankTable { int v[11][6]; };
+constexpr RankTable makeRankTable() {
+    RankTable t{};
+    for (int n = 0; n <= 10; ++n) for (int k = 0; k <= 5; ++k) t.v[n][k] = binom(n, k);
+    return t;
+}
+inline constexpr RankTable RANK_BINOM = makeRankTable();
+
+constexpr int diceIn(const uint8_t* c) { return c[0] + c[1] + c[2] + c[3] + c[4] + c[5]; }
+constexpr int rankCounts(const uint8_t* c) {
+    int r = 0, i = 0;
+    for (int f = 0; f < 6; ++f)
+        for (int k = 0; k < c[f]; ++k, ++i) r += RANK_BINOM.v[f + i][i + 1];
+    return r;
+}
+constexpr int keepIndex(const FaceCounts& c) { return KEEP_BASE[diceIn(c.data())] + rankCounts(c.data()); }
+constexpr int handIndex(const FaceCounts& c) { return rankCounts(c.data()); }
+//      (ֻ n      )
+constexpr int multinomial(const uint8_t* c) {
+    int w = FACTORIAL[diceIn(c)];
+    for (int f = 0; f < 6; ++f) w /= FACTORIAL[c[f]];
+    return w;
+}
+
+// scoreCategory   Ģ   
+constexpr int scoreCounts(Category cat, const uint8_t* c) {
+    int sum = 0, maxCount = 0, run = 0, bestRun = 0;
+    bool three = false, two = false;
+    for (int f = 0; f < 6; ++f) {
+        sum += c[f] * (f + 1);
+        if (c[f] > maxCount) maxCount = c[f];
+        if (c[f] == 3) three = true;
+        if (c[f] == 2) two = true;
+        run = c[f] ? run + 1 : 0;
+        if (run > bestRun) bestRun = run;
+    }
+    switch (cat) {
+    case Category::ONES: case Category::TWOS: case Category::THREES:
+    case Category::FOURS: case Category::FIVES: case Category::SIXES: {
+        int f = static_cast<int>(cat);
+        return c[f] * (f + 1);
+    }
+    case Category::THREE_KIND: return maxCount >= 3 ? sum : 0;
+    case Category::FOUR_KIND: return maxCount >= 4 ? sum : 0;
+    case Category::FULL_HOUSE: return (three && two) ? FULL_HOUSE_SCORE : 0;
+    case Category::SMALL_STRAIGHT: return bestRun >= 4 ? SMALL_STRAIGHT_SCORE : 0;
+    case Category::LARGE_STRAIGHT: return bestRun >= 5 ? LARGE_STRAIGHT_SCORE : 0;
+    case Category::YAHTZEE: return maxCount == 5 ? YAHTZEE_SCORE : 0;
+    case Category::CHANCE: return sum;
+    default: return 0;
+    }
+}
+
+constexpr array<FaceCounts, KEEP_COUNT> makeKeepFaces() {
+    array<FaceCounts, KEEP_COUNT> t{};
+    FaceCounts* out = t.data();
+    for (int a = 0; a <= 5; ++a)
+        for (int b = 0; a + b <= 5; ++b)
+            for (int c = 0; a + b + c <= 5; ++c)
+                for (int d = 0; a + b + c + d <= 5; ++d)
+                    for (int e = 0; a + b + c + d + e <= 5; ++e)
+                        for (int f = 0; a + b + c + d + e + f <= 5; ++f) {
+                            uint8_t fc[6] = { static_cast<uint8_t>(a), static_cast<uint8_t>(b), static_cast<uint8_t>(c),
+                                static_cast<uint8_t>(d), static_cast<uint8_t>(e), static_cast<uint8_t>(f) };
+                            uint8_t* dst = out[KEEP_BASE[diceIn(fc)] + rankCounts(fc)].data();
+                            for (int i = 0; i < 6; ++i) dst[i] = fc[i];
+                        }
+    return t;
+}
+inline constexpr array<FaceCounts, KEEP_COUNT> KEEP_FACES = makeKeepFaces();
+
+constexpr array<FaceCounts, HAND_COUNT> makeHandFaces() {
+    array<FaceCounts, HAND_COUNT> t{};
+    const FaceCounts* src = KEEP_FACES.data() + KEEP_BASE[5];
+    FaceCounts* out = t.data();
+    for (int h = 0; h < HAND_COUNT; ++h) out[h] = src[h];
+    return t;
+}
+inline constexpr array<FaceCounts, HAND_COUNT> HAND_FACES = makeHandFaces();
+
+constexpr array<array<uint8_t, CAT_N>, HAND_COUNT> makeHandScores() {
+    array<array<uint8_t, CAT_N>, HAND_COUNT> t{};
+    const FaceCounts* hands = HAND_FACES.data();
+    for (int h = 0; h < HAND_COUNT; ++h) {
+        uint8_t* row = t.data()[h].data();
+        for (int c = 0; c < CAT_N; ++c) row[c] = static_cast<uint8_t>(scoreCounts(static_cast<Category>(c), hands[h].data()));
+    }
+    return t;
+}
+inline constexpr array<array<uint8_t, CAT_N>, HAND_COUNT> HAND_SCORES = makeHandScores();
+
+//   k ->    hand  (CSR: k  ׸ offset[k] .. offset[k + 1])
+struct RerollTable {
+    array<uint16_t, KEEP_COUNT + 1> offset;
+    array<uint8_t, OUTCOME_COUNT> hand;
+    array<uint8_t, OUTCOME_COUNT> weight;       //  . Ȯ = weight / 6^( ֻ )
+    array<double, OUTCOME_COUNT> prob;
+};
+constexpr RerollTable makeRerollTable() {
+    RerollTable t{};
+    const FaceCounts* keeps = KEEP_FACES.data();
+    uint16_t* offset = t.offset.data();
+    uint8_t* hand = t.hand.data();
+    uint8_t* weight = t.weight.data();
+    double* prob = t.prob.data();
+    int n = 0;
+    for (int k = 0; k < KEEP_COUNT; ++k) {
+        offset[k] = static_cast<uint16_t>(n);
+        const uint8_t* kept = keeps[k].data();
+        const int m = 5 - diceIn(kept);
+        //  m   = ũ m  keep 
+        for (int r = KEEP_BASE[m]; r < KEEP_BASE[m + 1]; ++r) {
+            const uint8_t* rolled = keeps[r].data();
+            uint8_t sum[6] = {};
+            for (int f = 0; f < 6; ++f) sum[f] = static_cast<uint8_t>(kept[f] + rolled[f]);
+            int w = multinomial(rolled);
+            hand[n] = static_cast<uint8_t>(rankCounts(sum));
+            weight[n] = static_cast<uint8_t>(w);
+            prob[n] = static_cast<double>(w) / POW6[m];
+            ++n;
+        }
+    }
+    offset[KEEP_COUNT] = static_cast<uint16_t>(n);
+    return t;
+}
+inline constexpr RerollTable REROLL = makeRerollTable();
+
+// hand -> ߺ  κ (  ִ keep) .  = prod(  + 1) <= 32
+struct SubKeepTable {
+    array<array<uint16_t, MAX_SUBKEEPS>, HAND_COUNT> keeps;
+    array<uint8_t, HAND_COUNT> count;
+};
+constexpr SubKeepTable makeSubKeepTable() {
+    SubKeepTable t{};
+    const FaceCounts* hands = HAND_FACES.data();
+    for (int h = 0; h < HAND_COUNT; ++h) {
+        const uint8_t* hc = hands[h].data();
+        uint16_t* out = t.keeps.data()[h].data();
+        uint8_t sub[6] = {};
+        int n = 0;
+        while (true) {
+            out[n++] = static_cast<uint16_t>(KEEP_BASE[diceIn(sub)] + rankCounts(sub));
+            int f = 0;
+            while (f < 6 && sub[f] == hc[f]) sub[f++] = 0;
+            if (f == 6) break;
+            sub[f]++;
+        }
+        t.count.data()[h] = static_cast<uint8_t>(n);
+    }
+    return t;
+}
+inline constexpr SubKeepTable SUBKEEPS = makeSubKeepTable();
+
+// ----- ˷   -----
+constexpr bool indexRoundTrips() {
+    for (int k = 0; k < KEEP_COUNT; ++k) if (keepIndex(KEEP_FACES.data()[k]) != k) return false;
+    for (int h = 0; h < HAND_COUNT; ++h) if (diceIn(HAND_FACES.data()[h].data()) != 5 || handIndex(HAND_FACES.data()[h]) != h) return false;
+    return true;
+}
+// ֻ 5  ְ  7776   ش īװ 0 ƴ   /  
+constexpr int orderedHits(Category cat) {
+    int n = 0;
+    for (int h = 0; h < HAND_COUNT; ++h)
+        if (HAND_SCORES.data()[h].data()[static_cast<int>(cat)] > 0) n += multinomial(HAND_FACES.data()[h].data());
+    return n;
+}
+constexpr int orderedScoreSum(Category cat) {
+    int s = 0;
+    for (int h = 0; h < HAND_COUNT; ++h)
+        s += HAND_SCORES.data()[h].data()[static_cast<int>(cat)] * multinomial(HAND_FACES.data()[h].data());
+    return s;
+}
+//  keep      = 6^( ֻ )
+constexpr bool rerollWeightsComplete() {
+    const uint16_t* offset = REROLL.offset.data();
+    const uint8_t* weight = REROLL.weight.data();
+    for (int k = 0; k < KEEP_COUNT; ++k) {
+        int sum = 0;
+        for (int i = offset[k]; i < offset[k + 1]; ++i) sum += weight[i];
+        if (sum != POW6[5 - diceIn(KEEP_FACES.data()[k].data())]) return false;
+    }
+    return true;
+}
+constexpr bool subKeepsComplete() {
+    int total = 0;
+    for (int h = 0; h < HAND_COUNT; ++h) {
+        const uint8_t* hc = HAND_FACES.data()[h].data();
+        int expect = 1;
+        for (int f = 0; f < 6; ++f) expect *= hc[f] + 1;
+        if (SUBKEEPS.count.data()[h] != expect) return false;
+        total += expect;
+    }
+    return total == OUTCOME_COUNT;      // Ī: κ  Ѽ =  ׸ 
+}
+
+static_assert(binom(10, 5) == HAND_COUNT && KEEP_BASE[6] == KEEP_COUNT, " ");
+static_assert(indexRoundTrips(), " ȣ űⰡ ϴ ƴմϴ");
+static_assert(REROLL.offset[KEEP_COUNT] == OUTCOME_COUNT, " ׸ ");
+static_assert(rerollWeightsComplete(), "ٽ   Ȯ  1  ƴմϴ");
+static_assert(subKeepsComplete(), "κ  ");
+static_assert(orderedHits(Category::YAHTZEE) == 6, " 6");
+static_assert(orderedHits(Category::LARGE_STRAIGHT) == 240, " ƮƮ 240");
+static_assert(orderedHits(Category::SMALL_STRAIGHT) == 1200, " ƮƮ( ) 1200");
+static_assert(orderedHits(Category::FULL_HOUSE) == 300, "ǮϿ콺 300");
+static_assert(orderedHits(Category::FOUR_KIND) == 156, "īε ̻ 156");
+static_assert(orderedHits(Category::THREE_KIND) == 1656, "īε ̻ 1656");
+static_assert(orderedScoreSum(Category::CHANCE) == 7776 * 35 / 2, "  17.5");
+static_assert(orderedScoreSum(Category::SIXES) == 7776 * 5, "Ľ  5");
+
+} // namespace dicetab
 
 #endif // GAMELOGIC_H
\ No newline at end of file
@@ -0,0 +1,421 @@
+#include "gameMcts.h"
+#include "gameAI.h"
+#include "gameOdds.h"
+#include "gameReroll.h"
+#include "gameRules.h"
+#include "gameSim.h"
+#include "gameTrace.h"
+#include "gameWinProb.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+using namespace dicetab;
+
+static mutex g_mctsConfigMutex;
+static MctsConfig g_mctsConfig;
+static atomic<uint64_t> g_mctsDecisions{ 0 }, g_mctsIterations{ 0 }, g_mctsTotalNs{ 0 }, g_mctsMaxNs{ 0 };
+
+void setMctsConfig(const MctsConfig& cfg) { lock_guard<mutex> lock(g_mctsConfigMutex); g_mctsConfig = cfg; }
+MctsConfig mctsConfig() { lock_guard<mutex> lock(g_mctsConfigMutex); return g_mctsConfig; }
+
+MctsStats mctsStats() {
+    MctsStats st;
+    st.decisions = g_mctsDecisions.load(memory_order_relaxed);
+    st.iterations = g_mctsIterations.load(memory_order_relaxed);
+    st.totalNs = g_mctsTotalNs.load(memory_order_relaxed);
+    st.maxNs = g_mctsMaxNs.load(memory_order_relaxed);
+    return st;
+}
+void resetMctsStats() {
+    g_mctsDecisions.store(0, memory_order_relaxed);
+    g_mctsIterations.store(0, memory_order_relaxed);
+    g_mctsTotalNs.store(0, memory_order_relaxed);
+    g_mctsMaxNs.store(0, memory_order_relaxed);
+}
+
+// =================== Ʈ ===================
+//  庰 Ǯ(vector) ΰ ȣ Ų. ڽ firstChild -> nextSibling  
+//  DECISION: (  key,  )   . ڽ = KEEP(  ) Ǵ CATEGORY(  0)
+//  KEEP    :   key.   쿬  쿬 , ڽ =   DECISION
+//  CATEGORY: ĭ key   ()
+enum MctsNodeKind : uint8_t { MCTS_DECISION, MCTS_KEEP, MCTS_CATEGORY };
+
+struct MctsNode {
+    int firstChild = -1;
+    int nextSibling = -1;
+    uint32_t visits = 0;
+    double total = 0;
+    uint16_t key = 0;
+    uint8_t rollsLeft = 0;
+    uint8_t kind = MCTS_DECISION;
+    bool expanded = false;
+};
+
+struct MctsRootStat {
+    uint16_t key;
+    uint32_t visits;
+    double total;
+};
+
+template <class R>
+class MctsSearch {
+public:
+    MctsSearch(vector<MctsNode>& pool, uint16_t usedMask, int upperSum, double exploration, uint64_t seed)
+        : pool(pool), usedMask(usedMask), upperSum(upperSum), exploration(exploration), rng(static_cast<unsigned>(seed)),
+          scores(rules::HAND_TABLE<R>.scores), future(futureScoreTable(R::VARIANT)) {
+        //  :   ̹   ּ  Ȯ  (籼  expectimax)
+        double keepValue[KEEP_COUNT];
+        for (int h = 0; h < HAND_COUNT; ++h) turnValue[0][h] = bestCategoryValue(h);
+        for (int r = 1; r <= 2; ++r) {
+            REROLL_MATRIX.expect(turnValue[r - 1], keepValue);
+            RerollMatrix::bestKeep(keepValue, turnValue[r]);
+        }
+    }
+
+    //  ݺϰ Ʈ ൿ 踦 out  ä
+    uint64_t run(int hand, int rollsLeft, chrono::steady_clock::time_point deadline, vector<MctsRootStat>& out) {
+        pool.clear();
+        pool.push_back(makeNode(MCTS_DECISION, static_cast<uint16_t>(hand), static_cast<uint8_t>(rollsLeft)));
+        uint64_t iterations = 0;
+        do {
+            for (int i = 0; i < 32; ++i) visit(0);
+            iterations += 32;
+        } while (chrono::steady_clock::now() < deadline);
+        out.clear();
+        for (int c = pool[0].firstChild; c >= 0; c = pool[c].nextSibling) out.push_back({ pool[c].key, pool[c].visits, pool[c].total });
+        return iterations;
+    }
+
+private:
+    vector<MctsNode>& pool;
+    const uint16_t usedMask;
+    const int upperSum;
+    const double exploration;
+    mt19937 rng;
+    const decltype(rules::HAND_TABLE<R>.scores)& scores;
+    const FutureScoreTable& future;
+    double turnValue[3][HAND_COUNT];    // [ ][ ]
+
+    static MctsNode makeNode(uint8_t kind, uint16_t key, uint8_t rollsLeft) {
+        MctsNode n;
+        n.kind = kind;
+        n.key = key;
+        n.rollsLeft = rollsLeft;
+        return n;
+    }
+    int addChild(int parent, const MctsNode& n) {
+        pool.push_back(n);
+        const int idx = static_cast<int>(pool.size()) - 1;
+        pool[idx].nextSibling = pool[parent].firstChild;
+        pool[parent].firstChild = idx;
+        return idx;
+    }
+
+    // ĭ c    h     = ̹  +  ĭ  
+    double leafValue(int h, int c) const {
+        const int s = scores[h][c];
+        const int upper = upperSum + (c <= static_cast<int>(Category::SIXES) ? s : 0);
+        return s + future(static_cast<uint16_t>(usedMask | 1u << c), upper);
+    }
+    double bestCategoryValue(int h) const {
+        double best = -1;
+        for (int c = 0; c < CAT_N; ++c) if (!(usedMask >> c & 1)) best = (std::max)(best, leafValue(h, c));
+        return best;
+    }
+    int sampleOutcome(int keep) {
+        const RerollMatrix& mx = REROLL_MATRIX;
+        double u = uniform_real_distribution<double>(0.0, 1.0)(rng);
+        int i = mx.rowBegin(keep);
+        for (; i < mx.rowEnd(keep) - 1; ++i) {
+            u -= mx.probability(i);
+            if (u <= 0) break;
+        }
+        return mx.outcome(i);
+    }
+    // ó ģ   .  ÷̾ƿ  ̸ Ǯ    ״ 
+    double rollout(int h, int rollsLeft) const { return turnValue[rollsLeft][h]; }
+    void expand(int node) {
+        MctsNode& n = pool[node];
+        const int h = n.key, rollsLeft = n.rollsLeft;
+        n.expanded = true;
+        if (rollsLeft > 0) {
+            for (int i = 0; i < SUBKEEPS.count[h]; ++i)
+                addChild(node, makeNode(MCTS_KEEP, SUBKEEPS.keeps[h][i], static_cast<uint8_t>(rollsLeft)));
+        }
+        else {
+            for (int c = 0; c < CAT_N; ++c)
+                if (!(usedMask >> c & 1)) addChild(node, makeNode(MCTS_CATEGORY, static_cast<uint16_t>(c), 0));
+        }
+    }
+    // UCT: 湮  ڽ , ״  + c * sqrt(ln N / n)
+    int select(int node) const {
+        const double logN = log(static_cast<double>(pool[node].visits) + 1);
+        int best = -1;
+        double bestScore = -1e300;
+        for (int c = pool[node].firstChild; c >= 0; c = pool[c].nextSibling) {
+            const MctsNode& ch = pool[c];
+            if (ch.visits == 0) return c;
+            const double score = ch.total / ch.visits + exploration * sqrt(logN / ch.visits);
+            if (score > bestScore) { bestScore = score; best = c; }
+        }
+        return best;
+    }
+    int outcomeChild(int keepNode, int h) {
+        for (int c = pool[keepNode].firstChild; c >= 0; c = pool[c].nextSibling) if (pool[c].key == h) return c;
+        return addChild(keepNode, makeNode(MCTS_DECISION, static_cast<uint16_t>(h), static_cast<uint8_t>(pool[keepNode].rollsLeft - 1)));
+    }
+    double visit(int node) {
+        double value;
+        if (!pool[node].expanded) {
+            expand(node);
+            value = rollout(pool[node].key, pool[node].rollsLeft);
+        }
+        else {
+            const int child = select(node);
+            if (pool[child].kind == MCTS_CATEGORY) {
+                value = leafValue(pool[node].key, pool[child].key);
+            }
+            else {
+                const int next = outcomeChild(child, sampleOutcome(pool[child].key));   // Ǯ Ŀ  Ƿ    ʴ´
+                value = visit(next);
+            }
+            pool[child].visits++;
+            pool[child].total += value;
+        }
+        pool[node].visits++;
+        pool[node].total += value;
+        return value;
+    }
+};
+
+// =================== Ž  Ǯ ===================
+//   ó ʿ   α׷   ϰ,     ñ.
+// ȣ 尡 0   . 尡  Ƿ thread_local  Ǯ  ̿ ȴ.
+// ٸ  Ž Ǯ  ̸ ٸ ʰ ȣ  ȥ ŽѴ (ð  Ű )
+class MctsWorkers {
+public:
+    static MctsWorkers& instance() {
+        static MctsWorkers workers;
+        return workers;
+    }
+    ~MctsWorkers() {
+        {
+            lock_guard<mutex> lk(mtx);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : helpers) t.join();
+    }
+
+    // fn(idx)  idx = 0..threads-1   ϰ   ȯ.     ȯ
+    template <class Fn>
+    int run(int threads, Fn& fn) {
+        return runRaw(threads, [](void* f, int idx) { (*static_cast<Fn*>(f))(idx); }, &fn);
+    }
+
+private:
+    using Job = void (*)(void*, int);
+    mutex runMtx;                       //    Ž ̸ 
+    mutex mtx;
+    condition_variable wake, done;
+    vector<thread> helpers;             // helpers[i]  (i + 1) 
+    Job job = nullptr;
+    void* ctx = nullptr;
+    uint64_t generation = 0;
+    int participants = 0;
+    int pending = 0;
+    bool stopping = false;
+
+    int runRaw(int threads, Job fn, void* arg) {
+        unique_lock<mutex> busy(runMtx, try_to_lock);
+        if (threads <= 1 || !busy.owns_lock()) { fn(arg, 0); return 1; }
+        {
+            lock_guard<mutex> lk(mtx);
+            while (static_cast<int>(helpers.size()) < threads - 1) {
+                const int idx = static_cast<int>(helpers.size()) + 1;
+                helpers.emplace_back([this, idx, gen = generation] { loop(idx, gen); });
+            }
+            job = fn;
+            ctx = arg;
+            participants = threads;
+            pending = threads - 1;
+            ++generation;
+        }
+        wake.notify_all();
+        fn(arg, 0);
+        unique_lock<mutex> lk(mtx);
+        done.wait(lk, [this] { return pending == 0; });
+        return threads;
+    }
+    void loop(int idx, uint64_t seen) {
+        traceThreadName("mcts worker");
+        unique_lock<mutex> lk(mtx);
+        for (;;) {
+            wake.wait(lk, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            if (idx >= participants) continue;
+            const Job fn = job;
+            void* arg = ctx;
+            lk.unlock();
+            fn(arg, idx);
+            lk.lock();
+            if (--pending == 0) done.notify_one();
+        }
+    }
+};
+
+// Ʈ : 帶 ڱ Ʈ Ű Ʈ ڽ 踸 ģ
+template <class R>
+static int searchRoot(int hand, int rollsLeft, uint16_t usedMask, int upperSum) {
+    TRACE_SCOPE("ai.mcts", "ai");
+    const MctsConfig cfg = mctsConfig();
+    const int threads = cfg.threads > 0 ? cfg.threads : (std::max)(1, static_cast<int>(thread::hardware_concurrency()));
+    const auto t0 = chrono::steady_clock::now();
+    const auto deadline = t0 + chrono::milliseconds((std::max)(1, cfg.budgetMs));
+    const uint64_t seed = g_rng();
+
+    vector<vector<MctsRootStat>> roots(threads);
+    vector<uint64_t> iterations(threads, 0);
+    auto worker = [&](int idx) {
+        static thread_local vector<MctsNode> pool;
+        MctsSearch<R> search(pool, usedMask, upperSum, cfg.exploration, seed * 0x9E3779B97F4A7C15ull + idx);
+        iterations[idx] = search.run(hand, rollsLeft, deadline, roots[idx]);
+    };
+    const int used = MctsWorkers::instance().run(threads, worker);
+
+    // 帶 ģ Ʈ ൿ ٸ  Ƿ   ൿ  
+    vector<MctsRootStat> merged;
+    for (int t = 0; t < used; ++t)
+        for (const MctsRootStat& s : roots[t]) {
+            auto m = find_if(merged.begin(), merged.end(), [&](const MctsRootStat& x) { return x.key == s.key; });
+            if (m == merged.end()) merged.push_back(s);
+            else { m->visits += s.visits; m->total += s.total; }
+        }
+    //   湮 ൿ (   )
+    int bestKey = merged.empty() ? 0 : merged[0].key;
+    uint32_t bestVisits = 0;
+    double bestMean = -1e300;
+    for (const MctsRootStat& m : merged) {
+        const double mean = m.visits ? m.total / m.visits : -1e300;
+        if (m.visits > bestVisits || (m.visits == bestVisits && mean > bestMean)) { bestVisits = m.visits; bestMean = mean; bestKey = m.key; }
+    }
+
+    uint64_t total = 0;
+    for (uint64_t n : iterations) total += n;
+    const uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+    g_mctsDecisions.fetch_add(1, memory_order_relaxed);
+    g_mctsIterations.fetch_add(total, memory_order_relaxed);
+    g_mctsTotalNs.fetch_add(ns, memory_order_relaxed);
+    uint64_t prev = g_mctsMaxNs.load(memory_order_relaxed);
+    while (ns > prev && !g_mctsMaxNs.compare_exchange_weak(prev, ns, memory_order_relaxed)) {}
+    return bestKey;
+}
+
+static uint16_t usedMaskOf(const Scorecard& sc) {
+    uint16_t m = 0;
+    for (int c = 0; c < CAT_N; ++c) if (sc.used[c]) m |= static_cast<uint16_t>(1u << c);
+    return m;
+}
+
+array<bool, 5> chooseHold_Mcts(const Dice& d, const Scorecard& self, int rollsLeft) {
+    if (rollsLeft <= 0) return { true, true, true, true, true };
+    const int keep = rules::withRules(rulesVariant(), [&](auto r) {
+        return searchRoot<decltype(r)>(handOf(d), (std::min)(rollsLeft, 2), usedMaskOf(self), self.upperSum());
+    });
+    return holdMaskFor(d, KEEP_FACES[keep]);
+}
+
+//    쿬 尡  Ž  : ĭ 򰡸 ٷ  (Ŀ  ݿ)
+Category chooseCategory_Mcts(const Dice& d, const Scorecard& self) {
+    const FutureScoreTable& future = futureScoreTable(rulesVariant());
+    const uint16_t used = usedMaskOf(self);
+    Category best = Category::CATEGORY_COUNT;
+    double bestValue = -1e300;
+    for (int c = 0; c < CAT_N; ++c) {
+        if (self.used[c]) continue;
+        const int s = scoreWithJoker(static_cast<Category>(c), d, self);
+        const double v = s + future(static_cast<uint16_t>(used | 1u << c), self.upperSum() + (c <= static_cast<int>(Category::SIXES) ? s : 0));
+        if (v > bestValue) { bestValue = v; best = static_cast<Category>(c); }
+    }
+    return best;
+}
+
+// =================== ġũ ===================
+// Ӻ  հ 95% ŷڱ  ( ٻ, 1.96 * ǥؿ)
+struct ScoreEstimate {
+    double mean = 0;
+    double variance = 0;        //  л (ǥл / n)
+    double half() const { return 1.96 * sqrt(variance); }
+};
+
+static ScoreEstimate estimate(const vector<int16_t>& totals) {
+    ScoreEstimate e;
+    const size_t n = totals.size();
+    if (n == 0) return e;
+    for (int16_t t : totals) e.mean += t;
+    e.mean /= static_cast<double>(n);
+    if (n < 2) return e;
+    double ss = 0;
+    for (int16_t t : totals) ss += (t - e.mean) * (t - e.mean);
+    e.variance = ss / static_cast<double>(n - 1) / static_cast<double>(n);
+    return e;
+}
+
+void runMctsBenchmark(int games) {
+    if (games < 1) games = 1;
+    const MctsConfig saved = mctsConfig();
+    const int hw = (std::max)(1, static_cast<int>(thread::hardware_concurrency()));
+
+    //  õ ȥ ϴ    ⸦  ( AI  ).
+    //    ǥ  40̶ 100̸  95%   +-8̴.
+    //  AI    0  ϸ    ̴   δ  ʴ´
+    auto solo = [&](AIDifficulty level) {
+        SimConfig cfg;
+        cfg.games = games;
+        cfg.threads = 1;
+        cfg.seats = { level };
+        cfg.seed = 7;
+        cfg.keepTotals = true;
+        return runSimulation(cfg);
+    };
+    const ScoreEstimate hard = estimate(solo(AIDifficulty::HARD).totals);
+    cout << fixed << setprecision(1) << u8" AI ():  " << hard.mean << u8" +- " << hard.half() << u8" (95% ), "
+        << games << u8"" << endl;
+    cout << setw(10) << u8" ms" << setw(12) << u8"" << setw(22) << u8" " << setw(24) << u8" "
+        << setw(16) << "iter/decision" << setw(12) << "iter/s" << setw(18) << u8" ִ ms" << endl;
+
+    vector<int> threadCounts{ 1 };
+    if (hw > 1) threadCounts.push_back(hw);
+    for (int budget : { 2, 10, 40 }) {
+        for (int threads : threadCounts) {
+            MctsConfig cfg = saved;
+            cfg.budgetMs = budget;
+            cfg.threads = threads;
+            setMctsConfig(cfg);
+            resetMctsStats();
+            const ScoreEstimate r = estimate(solo(AIDifficulty::MCTS).totals);
+            MctsStats st = mctsStats();
+            const double diff = r.mean - hard.mean, diffHalf = 1.96 * sqrt(r.variance + hard.variance);
+            char score[32], vsHard[48];
+            snprintf(score, sizeof(score), "%.1f +- %.1f", r.mean, r.half());
+            snprintf(vsHard, sizeof(vsHard), "%+.1f +- %.1f%s", diff, diffHalf, fabs(diff) > diffHalf ? " *" : "  ");
+            cout << setw(10) << budget << setw(9) << threads << setw(18) << score << setw(20) << vsHard
+                << setw(16) << setprecision(0) << (st.decisions ? double(st.iterations) / st.decisions : 0.0)
+                << setw(12) << (st.totalNs ? st.iterations / (st.totalNs / 1e9) : 0.0)
+                << setw(14) << setprecision(2) << st.maxNs / 1e6 << endl;
+        }
+    }
+    setMctsConfig(saved);
+    cout << u8"* = ̰ 95%   ( AI  ϰ ٸ)" << endl;
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#ifndef GAMEMCTS_H
+#define GAMEMCTS_H
+
+#include <array>
+#include <cstdint>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// =================== MCTS AI ===================
+//    (Ȧ =   ,  = 쿬 ,  ĭ ) ī Ʈ Ž .
+//  "̹   +  ĭ  (FutureScoreTable)" ϰ,  ģ  
+//     籼  expectimax  Ǯ    ٷ Ѵ.
+//  ĭ 3 ϸ / AI ó  Ȯ Ǯ̸ .   AI    ̵.
+// 帶  Ʈ Ű(root parallelism) ð  Ǹ Ʈ ൿ 湮     湮 ൿ .
+//  ð ȮϹǷ  絵 ׶ ã ּ ش
+struct MctsConfig {
+    int budgetMs = 20;          //    ð 
+    int threads = 0;            // 0 = ϵ  
+    double exploration = 6.0;   // UCT Ž  ( )
+};
+void setMctsConfig(const MctsConfig& cfg);
+MctsConfig mctsConfig();
+
+array<bool, 5> chooseHold_Mcts(const Dice& d, const Scorecard& self, int rollsLeft);
+Category chooseCategory_Mcts(const Dice& d, const Scorecard& self);
+
+struct MctsStats {
+    uint64_t decisions = 0;
+    uint64_t iterations = 0;    //   Ž ݺ 
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+};
+MctsStats mctsStats();
+void resetMctsStats();
+
+// ð /     ʴ ݺ  ( --bench-mcts)
+void runMctsBenchmark(int games);
+
+#endif // GAMEMCTS_H
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "gameNet.h"
+
+#ifdef _WIN32
+#pragma comment(lib, "ws2_32.lib")
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// ===================  ȣȯ  ===================
+bool netStartup() {
+#ifdef _WIN32
+    WSADATA wsa;
+    return WSAStartup(MAKEWORD(2, 2), &wsa) == 0;
+#else
+    return true;
+#endif
+}
+void closeSocket(socket_t s) {
+#ifdef _WIN32
+    closesocket(s);
+#else
+    close(s);
+#endif
+}
+bool setNonBlocking(socket_t s) {
+#ifdef _WIN32
+    u_long mode = 1;
+    return ioctlsocket(s, FIONBIO, &mode) == 0;
+#else
+    int flags = fcntl(s, F_GETFL, 0);
+    return flags >= 0 && fcntl(s, F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+}
+void setNoDelay(socket_t s) {
+    int one = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&one), sizeof(one));
+}
+socket_t listenTcp(uint16_t port, int backlog) {
+    socket_t s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == INVALID_SOCK) return INVALID_SOCK;
+    int one = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&one), sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (::bind(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(s, backlog) != 0) {
+        closeSocket(s);
+        return INVALID_SOCK;
+    }
+    return s;
+}
+socket_t acceptTcp(socket_t listener) {
+    socket_t c = accept(listener, nullptr, nullptr);
+    if (c == INVALID_SOCK) return INVALID_SOCK;
+    setNoDelay(c);
+    return c;
+}
+socket_t connectTcp(const string& host, uint16_t port) {
+    socket_t s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == INVALID_SOCK) return INVALID_SOCK;
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, host.c_str(), &addr.sin_addr);
+    if (connect(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        closeSocket(s);
+        return INVALID_SOCK;
+    }
+    setNoDelay(s);
+    return s;
+}
+uint16_t localPort(socket_t s) {
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (getsockname(s, reinterpret_cast<sockaddr*>(&addr), &len) != 0) return 0;
+    return ntohs(addr.sin_port);
+}
+int pollSockets(vector<pollfd>& fds, int timeoutMs) {
+#ifdef _WIN32
+    return WSAPoll(fds.data(), (ULONG)fds.size(), timeoutMs);
+#else
+    return poll(fds.data(), fds.size(), timeoutMs);
+#endif
+}
+bool lastErrorWouldBlock() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+long sendSome(socket_t s, const char* data, size_t len) {
+    long n = (long)send(s, data, (int)len, MSG_NOSIGNAL);
+    if (n < 0) return lastErrorWouldBlock() ? 0 : -1;
+    return n;
+}
+long recvSome(socket_t s, char* data, size_t len) {
+    long n = (long)recv(s, data, (int)len, 0);
+    if (n == 0) return -1;
+    if (n < 0) return lastErrorWouldBlock() ? 0 : -1;
+    return n;
+}
+long sendSlices(socket_t s, const IoSlice* slices, size_t count) {
+    if (count > MAX_IO_SLICES) count = MAX_IO_SLICES;
+#ifdef _WIN32
+    WSABUF bufs[MAX_IO_SLICES];
+    for (size_t i = 0; i < count; ++i) { bufs[i].buf = const_cast<char*>(slices[i].data); bufs[i].len = (ULONG)slices[i].len; }
+    DWORD sent = 0;
+    if (WSASend(s, bufs, (DWORD)count, &sent, 0, nullptr, nullptr) != 0) return lastErrorWouldBlock() ? 0 : -1;
+    return (long)sent;
+#else
+    // writev   gather  MSG_NOSIGNAL    ִ sendmsg 
+    iovec iov[MAX_IO_SLICES];
+    for (size_t i = 0; i < count; ++i) { iov[i].iov_base = const_cast<char*>(slices[i].data); iov[i].iov_len = slices[i].len; }
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+    long n = (long)sendmsg(s, &msg, MSG_NOSIGNAL);
+    if (n < 0) return lastErrorWouldBlock() ? 0 : -1;
+    return n;
+#endif
+}
+
+// ===================  ===================
+size_t writeFrame(char* out, MsgType type, const void* payload, size_t len) {
+    uint16_t body = static_cast<uint16_t>(len + 1);
+    out[0] = static_cast<char>(body & 0xFF);
+    out[1] = static_cast<char>(body >> 8);
+    out[2] = static_cast<char>(type);
+    if (len) memcpy(out + FRAME_HEADER, payload, len);
+    return FRAME_HEADER + len;
+}
+bool sendFrameBlocking(socket_t s, MsgType type, const void* payload, size_t len) {
+    char frame[MAX_FRAME];
+    if (len + FRAME_HEADER > MAX_FRAME) return false;
+    size_t total = writeFrame(frame, type, payload, len);
+    size_t sent = 0;
+    while (sent < total) {
+        long n = (long)send(s, frame + sent, (int)(total - sent), MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += (size_t)n;
+    }
+    return true;
+}
+static bool recvExact(socket_t s, char* out, size_t len) {
+    size_t got = 0;
+    while (got < len) {
+        long n = (long)recv(s, out + got, (int)(len - got), 0);
+        if (n <= 0) return false;
+        got += (size_t)n;
+    }
+    return true;
+}
+bool recvFrameBlocking(socket_t s, MsgType& type, vector<char>& payload) {
+    char hdr[FRAME_HEADER];
+    if (!recvExact(s, hdr, FRAME_HEADER)) return false;
+    size_t body = static_cast<uint8_t>(hdr[0]) | (static_cast<uint8_t>(hdr[1]) << 8);
+    if (body < 1 || body + 2 > MAX_FRAME) return false;
+    type = static_cast<MsgType>(hdr[2]);
+    payload.resize(body - 1);
+    return payload.empty() || recvExact(s, payload.data(), payload.size());
+}
+
+void FrameReader::append(const char* data, size_t len) {
+    if (head > 0 && head == buf.size()) { buf.clear(); head = 0; }
+    else if (head > MAX_FRAME) { buf.erase(buf.begin(), buf.begin() + head); head = 0; }
+    buf.insert(buf.end(), data, data + len);
+}
+bool FrameReader::next(MsgType& type, const char*& payload, size_t& len) {
+    size_t avail = buf.size() - head;
+    if (avail < FRAME_HEADER) return false;
+    size_t body = static_cast<uint8_t>(buf[head]) | (static_cast<uint8_t>(buf[head + 1]) << 8);
+    if (body < 1 || body + 2 > MAX_FRAME) return false;
+    if (avail < body + 2) return false;
+    type = static_cast<MsgType>(buf[head + 2]);
+    payload = buf.data() + head + FRAME_HEADER;
+    len = body - 1;
+    head += body + 2;
+    return true;
+}
+bool FrameReader::overflowed() const {
+    size_t avail = buf.size() - head;
+    if (avail < 2) return false;
+    size_t body = static_cast<uint8_t>(buf[head]) | (static_cast<uint8_t>(buf[head + 1]) << 8);
+    return body < 1 || body + 2 > MAX_FRAME;
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+#ifndef GAMENET_H
+#define GAMENET_H
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <sys/uio.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// ===================  ȣȯ  ===================
+#ifdef _WIN32
+using socket_t = SOCKET;
+const socket_t INVALID_SOCK = INVALID_SOCKET;
+#else
+using socket_t = int;
+const socket_t INVALID_SOCK = -1;
+#endif
+
+bool netStartup();
+void closeSocket(socket_t s);
+bool setNonBlocking(socket_t s);
+void setNoDelay(socket_t s);
+socket_t listenTcp(uint16_t port, int backlog = 512);
+socket_t acceptTcp(socket_t listener);
+socket_t connectTcp(const string& host, uint16_t port);
+uint16_t localPort(socket_t s);
+int pollSockets(vector<pollfd>& fds, int timeoutMs);
+bool lastErrorWouldBlock();
+long sendSome(socket_t s, const char* data, size_t len);   // -1 = , 0 =   
+long recvSome(socket_t s, char* data, size_t len);         // -1 = /, 0 =   
+
+//  ۸     ý ݷ  (POSIX sendmsg / Windows WSASend)
+struct IoSlice {
+    const char* data;
+    size_t len;
+};
+constexpr size_t MAX_IO_SLICES = 64;
+long sendSlices(socket_t s, const IoSlice* slices, size_t count);   // -1 = , 0 =   
+
+// ===================  ===================
+// : [u16 (Ÿ+̷ε, LE)][u8 Ÿ][̷ε]
+enum class MsgType : uint8_t {
+    JOIN = 1,   // u32 room, ̸( Ʈ)
+    ADD_AI,     // u8 ̵
+    START,
+    ROLL,
+    HOLD,       // u8 Ȧ ũ (bit i = i ֻ)
+    SCORE,      // u8 īװ
+    SPECTATE,   // u32 room. ڷ  (  AI   )
+    STATE = 32, //   (encodeRoomState )
+    ERR,        // u8  ڵ
+    EVENT,      //   (encodeSpectatorFrame , ̸ )
+    KEYFRAME,   //   (̸ , 絿ȭ )
+};
+
+constexpr size_t FRAME_HEADER = 3;
+constexpr size_t MAX_FRAME = 512;
+
+size_t writeFrame(char* out, MsgType type, const void* payload, size_t len);
+bool sendFrameBlocking(socket_t s, MsgType type, const void* payload, size_t len);
+bool recvFrameBlocking(socket_t s, MsgType& type, vector<char>& payload);
+
+// ŷ Ͽ  Ʈ ϰ ϼ  
+struct FrameReader {
+    vector<char> buf;
+    size_t head = 0;
+
+    void append(const char* data, size_t len);
+    //  ϳ ϼǾ true. payload   next ȣ  ȿ
+    bool next(MsgType& type, const char*& payload, size_t& len);
+    bool overflowed() const;
+};
+
+#endif // GAMENET_H
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include "gameOdds.h"
+#include "gameReroll.h"
+#include "gameRules.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+
+using namespace dicetab;
+
+static FaceCounts countsOf(const Dice& d, const array<bool, 5>* held) {
+    FaceCounts c{};
+    for (int i = 0; i < 5; ++i) if (!held || (*held)[i]) c[d[i] - 1]++;
+    return c;
+}
+
+int handOf(const Dice& d) { return handIndex(countsOf(d, nullptr)); }
+int keepOf(const Dice& d, const array<bool, 5>& held) { return keepIndex(countsOf(d, &held)); }
+
+// =================== īװ ǥ (ǰ ϹǷ   ) ===================
+// ǥ  V0(hand)   W_r(keep) = r    ּ   밪
+//  W_1(k) = sum p * V0,  V_1(h) = max_{k  h} W_1(k),  W_2(k) = sum p * V_1
+struct CategoryTables {
+    // [ǥ][ 1..2][keep]. ǥ = īװ (0..12), ޼ (13..25)
+    vector<array<array<double, KEEP_COUNT>, 2>> w;
+};
+
+// ǥ Ģ   ( rules::HAND_TABLE<R>). ٽ   ֻ 5/6 Ģ 
+template <class R>
+static bool achieved(int h, int c) {
+    static_assert(R::DICE == 5 && R::FACES == 6, "REROLL_MATRIX  ֻ 5, 6 ");
+    if (c <= static_cast<int>(Category::SIXES)) return rules::HAND_TABLE<R>.faces[h][c] >= 3;
+    return rules::HAND_TABLE<R>.scores[h][c] > 0;
+}
+
+template <class R>
+static CategoryTables buildCategoryTables() {
+    CategoryTables ct;
+    ct.w.resize(CAT_N * 2);
+    double v0[HAND_COUNT];
+    for (int goal = 0; goal < CAT_N * 2; ++goal) {
+        int c = goal % CAT_N;
+        for (int h = 0; h < HAND_COUNT; ++h) v0[h] = goal < CAT_N ? rules::HAND_TABLE<R>.scores[h][c] : (achieved<R>(h, c) ? 1.0 : 0.0);
+        REROLL_MATRIX.expect2(v0, ct.w[goal][0].data(), ct.w[goal][1].data());
+    }
+    return ct;
+}
+
+template <class R>
+static const CategoryTables& categoryTables() {
+    static const CategoryTables tables = buildCategoryTables<R>();
+    return tables;
+}
+
+array<bool, 5> holdMaskFor(const Dice& d, const FaceCounts& keep) {
+    FaceCounts left = keep;
+    array<bool, 5> held{};
+    for (int i = 0; i < 5; ++i) if (left[d[i] - 1] > 0) { held[i] = true; left[d[i] - 1]--; }
+    return held;
+}
+
+template <class R>
+static void computeOddsHintImpl(const Dice& dice, const array<bool, 5>& held, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft, OddsHint& out) {
+    const auto& scores = rules::HAND_TABLE<R>.scores;
+    auto t0 = chrono::steady_clock::now();
+    const int hand = handOf(dice);
+    out = OddsHint();
+
+    if (rollsLeft <= 0) {
+        for (int c = 0; c < CAT_N; ++c) {
+            out.categories[c].open = !used[c];
+            out.categories[c].probability = achieved<R>(hand, c) ? 1.0 : 0.0;
+            out.categories[c].expected = scores[hand][c];
+        }
+        out.bestHold = { true, true, true, true, true };
+        out.computeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        return;
+    }
+    const int level = (std::min)(rollsLeft, 2) - 1;
+    const uint16_t* subKeeps = SUBKEEPS.keeps[hand].data();
+    const int subCount = SUBKEEPS.count[hand];
+
+    // īװ: ̸  ǥ   κ   ִ
+    const CategoryTables& ct = categoryTables<R>();
+    for (int c = 0; c < CAT_N; ++c) {
+        CategoryOdds& co = out.categories[c];
+        co.open = !used[c];
+        if (!co.open) continue;
+        for (int i = 0; i < subCount; ++i) {
+            co.expected = (std::max)(co.expected, ct.w[c][level][subKeeps[i]]);
+            co.probability = (std::max)(co.probability, ct.w[CAT_N + c][level][subKeeps[i]]);
+        }
+    }
+
+    // õ Ȧ: ǿ  ǥ ޶Ƿ Ź  ( 1.3  -)
+    static thread_local double v0[HAND_COUNT], v1[HAND_COUNT], w1[KEEP_COUNT];
+    for (int h = 0; h < HAND_COUNT; ++h) {
+        int best = 0;
+        for (int c = 0; c < CAT_N; ++c) if (!used[c]) best = (std::max)(best, static_cast<int>(scores[h][c]));
+        v0[h] = best;
+    }
+    const RerollMatrix& mx = REROLL_MATRIX;
+    mx.expect(v0, w1);
+    if (level == 1) RerollMatrix::bestKeep(w1, v1);
+    auto keepValue = [&](int k) { return level == 0 ? w1[k] : mx.expect(k, v1); };
+
+    int bestKeep = 0;
+    out.bestHoldEV = -1;
+    for (int i = 0; i < subCount; ++i) {
+        double v = keepValue(subKeeps[i]);
+        if (v > out.bestHoldEV + 1e-9) { out.bestHoldEV = v; bestKeep = subKeeps[i]; }
+    }
+    out.bestHold = holdMaskFor(dice, KEEP_FACES[bestKeep]);
+    out.currentHoldEV = keepValue(keepOf(dice, held));
+    out.computeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+void computeOddsHint(const Dice& dice, const array<bool, 5>& held, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft, OddsHint& out) {
+    rules::withRules(rulesVariant(), [&](auto r) { computeOddsHintImpl<decltype(r)>(dice, held, used, rollsLeft, out); });
+}
+
+void runOddsBenchmark(int iterations) {
+    if (iterations < 1) iterations = 1;
+    auto t0 = chrono::steady_clock::now();
+    rules::withRules(rulesVariant(), [](auto r) { categoryTables<decltype(r)>(); });
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    OddsHint hint;
+    double total = 0, worst = 0;
+    double checksum = 0;
+    for (int i = 0; i < iterations; ++i) {
+        Dice d;
+        for (auto& v : d) v = roll6();
+        array<bool, 5> held{};
+        for (auto& h : held) h = roll6() > 3;
+        array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)> used{};
+        for (auto&& u : used) u = roll6() > 4;
+        used[g_rng() % CAT_N] = false;
+        computeOddsHint(d, held, used, 1 + i % 2, hint);
+        total += hint.computeMs;
+        worst = (std::max)(worst, hint.computeMs);
+        checksum += hint.bestHoldEV;
+    }
+    cout << fixed << setprecision(3)
+        << u8"īװ 밪 ǥ : " << buildMs << " ms" << endl
+        << u8"Ʈ :  " << total / iterations << u8" ms, ִ " << worst << " ms (" << iterations << u8"ȸ,  " << setprecision(1) << checksum << ")" << endl;
+}
+
+// ===================     (񱳿) ===================
+// dicetab  :   6  ǥ    vector  ä
+struct RuntimeTables {
+    vector<FaceCounts> hands, keeps;
+    vector<array<uint8_t, CAT_N>> scores;
+    vector<vector<pair<int16_t, double>>> outcomes;
+    vector<vector<int16_t>> handKeeps;
+    vector<int16_t> keepIndex, handIndex;
+
+    size_t bytes() const {
+        size_t b = sizeof(*this) + (hands.capacity() + keeps.capacity()) * sizeof(FaceCounts) + scores.capacity() * sizeof(scores[0])
+            + (keepIndex.capacity() + handIndex.capacity()) * sizeof(int16_t);
+        for (const auto& v : outcomes) b += sizeof(v) + v.capacity() * sizeof(v[0]);
+        for (const auto& v : handKeeps) b += sizeof(v) + v.capacity() * sizeof(v[0]);
+        return b;
+    }
+};
+
+static int code6(const FaceCounts& c) {
+    int code = 0;
+    for (int f = 5; f >= 0; --f) code = code * 6 + c[f];
+    return code;
+}
+static void enumerateCounts(int total, vector<FaceCounts>& out) {
+    FaceCounts c{};
+    auto rec = [&](auto& self, int face, int left) -> void {
+        if (face == 5) { c[5] = static_cast<uint8_t>(left); out.push_back(c); return; }
+        for (int k = left; k >= 0; --k) { c[face] = static_cast<uint8_t>(k); self(self, face + 1, left - k); }
+    };
+    rec(rec, 0, total);
+}
+
+static RuntimeTables buildRuntimeTables() {
+    RuntimeTables t;
+    const int CODES = 6 * 6 * 6 * 6 * 6 * 6;
+    t.keepIndex.assign(CODES, -1);
+    t.handIndex.assign(CODES, -1);
+    enumerateCounts(5, t.hands);
+    for (size_t h = 0; h < t.hands.size(); ++h) {
+        t.handIndex[code6(t.hands[h])] = static_cast<int16_t>(h);
+        Dice d{};
+        int n = 0;
+        for (int f = 0; f < 6; ++f) for (int k = 0; k < t.hands[h][f]; ++k) d[n++] = f + 1;
+        array<uint8_t, CAT_N> row{};
+        for (int c = 0; c < CAT_N; ++c) row[c] = static_cast<uint8_t>(scoreCategory(static_cast<Category>(c), d));
+        t.scores.push_back(row);
+    }
+    for (int n = 0; n <= 5; ++n) enumerateCounts(n, t.keeps);
+    for (size_t k = 0; k < t.keeps.size(); ++k) t.keepIndex[code6(t.keeps[k])] = static_cast<int16_t>(k);
+
+    static const double FACT[6] = { 1, 1, 2, 6, 24, 120 };
+    t.outcomes.resize(t.keeps.size());
+    vector<FaceCounts> rolls;
+    for (size_t k = 0; k < t.keeps.size(); ++k) {
+        int m = 5 - diceIn(t.keeps[k].data());
+        rolls.clear();
+        enumerateCounts(m, rolls);
+        for (const auto& r : rolls) {
+            FaceCounts sum;
+            double p = FACT[m] / POW6[m];
+            for (int f = 0; f < 6; ++f) { sum[f] = static_cast<uint8_t>(t.keeps[k][f] + r[f]); p /= FACT[r[f]]; }
+            t.outcomes[k].push_back({ t.handIndex[code6(sum)], p });
+        }
+    }
+    t.handKeeps.resize(t.hands.size());
+    for (size_t h = 0; h < t.hands.size(); ++h) {
+        FaceCounts sub{};
+        auto rec = [&](auto& self, int face) -> void {
+            if (face == 6) { t.handKeeps[h].push_back(t.keepIndex[code6(sub)]); return; }
+            for (int k = 0; k <= t.hands[h][face]; ++k) { sub[face] = static_cast<uint8_t>(k); self(self, face + 1); }
+        };
+        rec(rec, 0);
+    }
+    return t;
+}
+
+void runTableBenchmark(int iterations) {
+    if (iterations < 1) iterations = 1;
+    size_t runtimeBytes = 0;
+    double checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        RuntimeTables t = buildRuntimeTables();
+        runtimeBytes = t.bytes();
+        checksum += t.outcomes[i % t.outcomes.size()].size();
+    }
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count() / iterations;
+
+    //    ǥ  ð ǥ   (ȣ ű  ٸ) Ȯ
+    RuntimeTables rt = buildRuntimeTables();
+    int mismatches = 0;
+    double probSum = 0;
+    for (size_t k = 0; k < rt.keeps.size(); ++k) {
+        int ck = keepIndex(rt.keeps[k]);
+        if (REROLL.offset[ck + 1] - REROLL.offset[ck] != static_cast<int>(rt.outcomes[k].size())) mismatches++;
+        for (const auto& o : rt.outcomes[k]) {
+            int ch = handIndex(rt.hands[o.first]);
+            bool found = false;
+            for (int i = REROLL.offset[ck]; i < REROLL.offset[ck + 1]; ++i)
+                if (REROLL.hand[i] == ch && fabs(REROLL.prob[i] - o.second) < 1e-12) found = true;
+            if (!found) mismatches++;
+            probSum += o.second;
+        }
+    }
+    for (size_t h = 0; h < rt.hands.size(); ++h)
+        if (rt.scores[h] != HAND_SCORES[handIndex(rt.hands[h])]) mismatches++;
+
+    const size_t constBytes = sizeof(KEEP_FACES) + sizeof(HAND_FACES) + sizeof(HAND_SCORES) + sizeof(REROLL) + sizeof(SUBKEEPS) + sizeof(RANK_BINOM);
+    cout << fixed << setprecision(3)
+        << u8" ð ǥ: " << constBytes << u8" Ʈ (б  ),   0" << endl
+        << u8"  KEEP_FACES " << sizeof(KEEP_FACES) << ", HAND_FACES " << sizeof(HAND_FACES) << ", HAND_SCORES " << sizeof(HAND_SCORES)
+        << ", REROLL " << sizeof(REROLL) << ", SUBKEEPS " << sizeof(SUBKEEPS) << endl
+        << u8"  : " << buildMs << u8" ms/ȸ (" << iterations << u8"ȸ ),  " << runtimeBytes << u8" Ʈ" << endl
+        << u8" : ġ " << mismatches << u8", Ȯ  " << setprecision(6) << probSum << " (= " << KEEP_COUNT << ")" << endl;
+    (void)checksum;
+}
\ No newline at end of file
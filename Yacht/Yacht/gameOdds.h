@@ -0,0 +1,44 @@
+#pragma once
+#ifndef GAMEODDS_H
+#define GAMEODDS_H
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+//  ǥ(hand 252, keep 462, ٽ   ) gameLogic.h  dicetab   ð 
+int handOf(const Dice& d);
+int keepOf(const Dice& d, const array<bool, 5>& held);
+//    ֻ ġ ٲ۴ (  տ)
+array<bool, 5> holdMaskFor(const Dice& d, const dicetab::FaceCounts& keep);
+
+// =================== Ʈ г ===================
+// īװ:  īװ 븮 ּ   ޼ Ȯ  
+//  (޼ = 0 ʰ.  1~6  ʽ    3 ̻)
+// õ Ȧ:    " īװ    " 밪 ִ Ȧ
+struct CategoryOdds {
+    bool open = false;
+    double probability = 0;
+    double expected = 0;
+};
+
+struct OddsHint {
+    array<CategoryOdds, static_cast<size_t>(Category::CATEGORY_COUNT)> categories;
+    array<bool, 5> bestHold{};
+    double bestHoldEV = 0;
+    double currentHoldEV = 0;           //  Ȧ ֻ    밪
+    double computeMs = 0;
+};
+
+void computeOddsHint(const Dice& dice, const array<bool, 5>& held, const array<bool, static_cast<size_t>(Category::CATEGORY_COUNT)>& used, int rollsLeft, OddsHint& out);
+
+// Ʈ  ð  ( --bench-odds)
+void runOddsBenchmark(int iterations);
+//  ð ǥ    ߿  /ũ  ( --bench-tables)
+void runTableBenchmark(int iterations);
+
+#endif // GAMEODDS_H
\ No newline at end of file
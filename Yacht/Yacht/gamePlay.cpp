@@ -5,8 +5,295 @@
 #endif
 
 #include "gameUI.h"
+#include "gameReplay.h"
+#include "gameCheckpoint.h"
+#include "gameAlloc.h"
+#include "gameTrace.h"
+#include "gameSim.h"
 #include <sstream>
 
+// Ϻη ٸ ð Է  ð  巯 Ѵ
+static void aiPause(int seconds) {
+    TRACE_SCOPE("sleep.aiPause", "sleep");
+    this_thread::sleep_for(chrono::seconds(seconds));
+}
+static void waitEnter() {
+    TRACE_SCOPE("input.waitEnter", "input");
+    string dummy; getline(cin, dummy);
+}
+
+//   ϰ  Ѵ. resume   üũƮ  ̾ 
+static void playGame(GameDB& db, vector<Scorecard>& players, const vector<bool>& is_computer,
+    const vector<AIDifficulty>& ai_difficulties, int numHumanPlayers, const CheckpointState* resume) {
+    Dice dice{ 1, 1, 1, 1, 1 };
+    array<bool, 5> held{};
+
+    // ¼ AI ̵ (üũƮ,  ¼  )
+    vector<AIDifficulty> seat_difficulty(players.size(), AIDifficulty::EASY);
+    for (size_t p = numHumanPlayers; p < players.size(); ++p) seat_difficulty[p] = ai_difficulties[p - numHumanPlayers];
+
+    // ÷ : õ带   / ̺Ʈ ޸𸮿 ״´.
+    // ̾ ϴ  պκ ̺Ʈ Ƿ  ʴ´
+    bool show_hints = false;    // [H]  Ѱ     
+
+    ReplayRecorder recorder;
+    uint64_t seed = (static_cast<uint64_t>(random_device{}()) << 32) | random_device{}();
+    seedRng(seed);
+    if (!resume) recorder.beginGame(seed, players);
+
+    // ̾ ϴ ̸  /÷̾,  ̾ٸ  ֻ º 
+    const int startRound = resume ? resume->round : 1;
+    const size_t startPlayer = resume ? static_cast<size_t>(resume->current) : 0;
+
+    // ޽ ڿ ϸ   ʰ   Ѵ
+    string statusMsg, errorMsg, prompt;
+    string_view combination;
+    const string_view human_prompt = "[T]oggle, [R]eroll, [S]core, [H]int: ";
+    resetAllocStats();
+
+    const int rounds = activeCategoryCount();   //  13, Ʈ 12
+    for (int round = startRound; round <= rounds; ++round) {
+        for (size_t p = (round == startRound ? startPlayer : 0); p < players.size(); ++p) {
+            TRACE_SCOPE("play.turn", "play");
+            AllocSpan turnSpan(allocTurnStats());
+            int rolls = 0;
+            setHintPanel(!is_computer[p] && show_hints);
+            auto checkpoint = [&]() {
+                TRACE_SCOPE("play.checkpoint", "play");
+                saveCheckpoint(round, (int)p, rolls, dice, held, players, is_computer, seat_difficulty);
+                };
+
+            statusMsg.clear();
+            errorMsg.clear();
+            if (resume && resume->rolls > 0 && round == startRound && p == startPlayer) {
+                dice = resume->dice;
+                held = resume->held;
+                rolls = resume->rolls;
+                statusMsg = u8"  ̾ մϴ.";
+            }
+            else {
+                checkpoint();
+                prompt.assign(players[p].name).append(is_computer[p] ? u8"  Դϴ.   մϴ..." : u8"  Դϴ. Enter Ű  ...");
+                redrawAll(round, (int)p, 3, dice, held, players, prompt);
+
+                if (is_computer[p]) aiPause(2);
+                else waitEnter();
+
+                held.fill(false);
+
+                redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", u8"ֻ ϴ...");
+                animateRoll(dice, held);
+                recorder.roll(held, dice);
+                rolls++;
+                checkpoint();
+
+                combination = checkForSpecialCombinations(dice);
+                if (!combination.empty()) displayImpactEffect(combination);
+            }
+
+            bool turn_over = false;
+            while (!turn_over && rolls < 3) {
+                if (is_computer[p]) {
+                    aiPause(1);
+                    AIDifficulty difficulty = ai_difficulties[p - numHumanPlayers];
+
+                    if (difficulty == AIDifficulty::EASY) {
+                        if (rolls < 3) {
+                            redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", u8"ֻ ϴ...");
+                            animateRoll(dice, held);
+                            recorder.roll(held, dice);
+                            rolls++;
+                            checkpoint();
+                            combination = checkForSpecialCombinations(dice);
+                            if (!combination.empty()) displayImpactEffect(combination);
+                        }
+                        else {
+                            turn_over = true;
+                        }
+                    }
+                    else {
+                        held = chooseHold(dice, players[p], &players, 3 - rolls, round, difficulty);
+                        bool all_held = true;
+                        for (bool h : held) if (!h) { all_held = false; break; }
+                        if (all_held) {
+                            turn_over = true;
+                        }
+                        else {
+                            redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", u8"ֻ ϴ...");
+                            animateRoll(dice, held);
+                            recorder.roll(held, dice);
+                            rolls++;
+                            checkpoint();
+                            combination = checkForSpecialCombinations(dice);
+                            if (!combination.empty()) displayImpactEffect(combination);
+                        }
+                    }
+                }
+                else {
+                    redrawAll(round, (int)p, 3 - rolls, dice, held, players, human_prompt, errorMsg, statusMsg);
+                    errorMsg.clear(); statusMsg.clear();
+                    string line, cmd_str;
+                    {
+                        TRACE_SCOPE("input.command", "input");
+                        getline(cin, line);
+                    }
+                    istringstream iss(line); iss >> cmd_str;
+                    char command = (cmd_str.empty()) ? ' ' : (char)toupper(cmd_str[0]);
+
+                    if (command == 'T') {
+                        size_t first_digit_pos = line.find_first_of("0123456789");
+                        if (first_digit_pos == string::npos) errorMsg = u8"߸ ɾԴϴ. (: t 1 2)";
+                        else {
+                            vector<int> indices = parseIndices(line.substr(first_digit_pos));
+                            for (int idx : indices) held[idx] = !held[idx];
+                            checkpoint();
+                        }
+                    }
+                    else if (command == 'R') {
+                        redrawAll(round, (int)p, 3 - rolls, dice, held, players, human_prompt, "", u8"ֻ ϴ...");
+                        animateRoll(dice, held);
+                        recorder.roll(held, dice);
+                        rolls++;
+                        checkpoint();
+                        combination = checkForSpecialCombinations(dice);
+                        if (!combination.empty()) displayImpactEffect(combination);
+                    }
+                    else if (command == 'S') {
+                        turn_over = true;
+                    }
+                    else if (command == 'H') {
+                        show_hints = !show_hints;
+                        setHintPanel(show_hints);
+                        statusMsg = show_hints ? u8"Ʈ г ׽ϴ." : u8"Ʈ г ϴ.";
+                    }
+                    else {
+                        errorMsg = u8"߸ ɾԴϴ.";
+                    }
+                }
+            }
+
+            Category chosenCat;
+            if (is_computer[p]) {
+                prompt.assign(players[p].name).append(u8"   մϴ...");
+                redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", prompt);
+                aiPause(2);
+                chosenCat = chooseCategory(dice, players[p], &players, round, ai_difficulties[p - numHumanPlayers]);
+            }
+            else {
+                bool score_chosen = false; errorMsg.clear();
+                while (!score_chosen) {
+                    redrawAll(round, (int)p, 3 - rolls, dice, held, players, u8" īװ ȣ Էϼ: ", errorMsg);
+                    errorMsg.clear();
+                    int cat_idx;
+                    bool read_ok;
+                    {
+                        TRACE_SCOPE("input.category", "input");
+                        read_ok = static_cast<bool>(cin >> cat_idx);
+                    }
+                    if (read_ok && cat_idx >= 1 && cat_idx <= 13) {
+                        chosenCat = static_cast<Category>(cat_idx - 1);
+                        if (!categoryActive(chosenCat)) errorMsg = u8" Ģ  īװԴϴ.";
+                        else if (!players[p].used[cat_idx - 1]) score_chosen = true;
+                        else errorMsg = u8"̹  īװԴϴ.";
+                    }
+                    else {
+                        errorMsg = u8"1~13  ڸ Էϼ.";
+                        cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+                    }
+                }
+                cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+            }
+
+            int bonusBefore = players[p].yahtzeeBonusCount;
+            int score = applyScore(players[p], chosenCat, dice);
+            recorder.score(chosenCat, score, players[p].yahtzeeBonusCount > bonusBefore);
+
+            statusMsg.assign(categoryName(chosenCat)).append(u8" ").append(to_string(score)).append(u8" ߽ϴ.");
+            redrawAll(round, (int)p, 0, dice, held, players, u8"Enter   ÷̾...", "", statusMsg);
+
+            if (is_computer[p]) aiPause(2);
+            else waitEnter();
+        }
+    }
+
+    setHintPanel(false);
+    recorder.endGame(players);
+    removeCheckpoint();
+
+    clearScreen();
+    writeAt(5, 2, u8"==========   ==========");
+    sort(players.begin(), players.end(), [](const Scorecard& a, const Scorecard& b) { return a.total() > b.total(); });
+    int y = 4;
+    for (const auto& pl : players) {
+        db.recordScore(pl.name, pl.total()); //   
+        writeAt(5, y++, fitName(pl.name, 15) + " : " + to_string(pl.total()) + u8"");
+    }
+    writeAt(5, y + 2, u8"'" + players[0].name + u8"'  ¸Դϴ!");
+    const CheckpointStats& cs = checkpointStats();
+    if (cs.saves > 0) {
+        ostringstream perf;
+        perf << fixed << setprecision(1) << u8"üũƮ " << cs.saves << u8"ȸ ,  " << cs.totalNs / cs.saves / 1000.0 << u8" us, ִ " << cs.maxNs / 1000.0 << " us";
+        writeAt(5, y + 3, perf.str());
+    }
+    if (allocHookEnabled()) {
+        const AllocSpanStats& ts = allocTurnStats();
+        const AllocSpanStats& fs = allocFrameStats();
+        ostringstream al;
+        al << fixed << setprecision(1) << u8"Ҵ: ϴ  " << (ts.spans ? double(ts.count) / ts.spans : 0.0) << u8"ȸ (ִ " << ts.maxCount << u8"ȸ, " << ts.maxBytes << u8" B),  "
+            << fs.spans << u8"  Ҵ  " << fs.spansWithAlloc << u8" (ִ " << fs.maxCount << u8"ȸ)";
+        writeAt(5, y + 4, al.str());
+    }
+    writeAt(5, y + 6, u8"ƹ Ű  ޴ ư...");
+    cin.get();
+}
+
+void runFastForwardSpectator(GameDB* db, const vector<string>& names, const vector<AIDifficulty>& seats, int games, int threads) {
+    TRACE_SCOPE("play.fastForward", "play");
+    if (games < 1) games = 1;
+    // Ž AI   ü 带  Ƿ    ʴ´
+    if (find(seats.begin(), seats.end(), AIDifficulty::MCTS) != seats.end()) threads = 1;
+    threads = (std::max)(1, threads);
+
+    vector<string> labels;
+    for (size_t p = 0; p < seats.size(); ++p) labels.push_back(names[p] + " (" + string(difficultyName(seats[p])) + ")");
+
+    SimConfig cfg;
+    cfg.games = games;
+    cfg.threads = threads;
+    cfg.seats = seats;
+    cfg.seed = (static_cast<uint64_t>(random_device{}()) << 32) | random_device{}();
+    cfg.keepTotals = db != nullptr;
+
+    bool first = true;
+    SimResult result = runSimulationLive(cfg, 250, [&](const SimResult& r) {
+        drawSimDashboard(r, games, threads, labels, first);
+        first = false;
+    });
+    const int y = drawSimDashboard(result, games, threads, labels, false);
+    if (!db) {
+        gotoXY(0, y);
+        cout.flush();
+        return;
+    }
+
+    //  Ͼ  ó Ӹ ¼   ,  ϳ ƴ϶  Ʈ Ѵ
+    writeAt(5, y, u8"    " + to_string(result.totals.size()) + u8" DB Ͻðڽϱ? (Y/N): ");
+    string answer; getline(cin, answer);
+    if (!answer.empty() && toupper(static_cast<unsigned char>(answer[0])) == 'Y') {
+        vector<ScoreEntry> entries;
+        entries.reserve(result.totals.size());
+        for (size_t i = 0; i < result.totals.size(); ++i) entries.push_back({ names[i % seats.size()], result.totals[i] });
+        const auto t0 = chrono::steady_clock::now();
+        const bool ok = db->recordScores(entries);
+        const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        ostringstream msg;
+        msg << fixed << setprecision(1) << (ok ? u8" Ϸ (" : u8"  (") << ms << " ms)";
+        writeAt(5, y + 1, msg.str());
+    }
+    writeAt(5, y + 3, u8"ƹ Ű  ޴ ư...");
+    cin.get();
+}
+
 void run_yahtzee_game(GameDB& db) {
     ios::sync_with_stdio(false); cin.tie(nullptr);
 #ifdef _WIN32
@@ -18,11 +305,37 @@ void run_yahtzee_game(GameDB& db) {
     ensureConsoleSize(120, 60);
 #endif
     hideCursor(true);
+    renderAssets();         // /ֻ ׸ ĳø ù ȭ   д
+
+    //    üũƮ  ̾  ´
+    CheckpointState saved;
+    if (loadCheckpoint(saved)) {
+        clearScreen();
+        writeAt(5, 2, u8"===== ̾ϱ =====");
+        writeAt(5, 4, u8"   ֽϴ. (" + to_string(saved.round) + u8", " + saved.players[saved.current].name + u8"  )");
+        int y = 6;
+        for (const auto& pl : saved.players) writeAt(7, y++, fitName(pl.name, 15) + " : " + to_string(pl.total()) + u8"");
+        writeAt(5, y + 1, u8"̾ Ͻðڽϱ? (Y/N): ");
+        string answer; getline(cin, answer);
+        if (!answer.empty() && toupper(static_cast<unsigned char>(answer[0])) == 'Y') {
+            vector<AIDifficulty> ai_difficulties;
+            int numHumanPlayers = 0;
+            for (size_t p = 0; p < saved.players.size(); ++p) {
+                if (saved.isComputer[p]) ai_difficulties.push_back(saved.difficulty[p]);
+                else numHumanPlayers++;
+            }
+            setRulesVariant(saved.rules);
+            playGame(db, saved.players, saved.isComputer, ai_difficulties, numHumanPlayers, &saved);
+        }
+        else {
+            removeCheckpoint();
+        }
+    }
 
     while (true) {
         clearScreen();
         writeAt(5, 2, u8"=====  (ܼ, ȼ Ʈ ֻ) =====");
-        writeAt(5, 4, u8"Ģ: 5 ֻ ִ 3  , 13 īװ  1ȸ  .");
+        writeAt(5, 4, u8"Ģ: 5 ֻ ִ 3  , īװ( 13, Ʈ 12)  1ȸ  .");
 
         int gameMode = 0;
         writeAt(5, 7, u8"---    ---");
@@ -30,21 +343,26 @@ void run_yahtzee_game(GameDB& db) {
         writeAt(5, 9, u8"2. AI  (Player vs AI)");
         writeAt(5, 10, u8"3. AI  (AI vs AI)");
         writeAt(5, 11, u8"4.  Ȯ");
-        writeAt(5, 12, u8"5. ");
-        writeAt(5, 14, u8"ϴ  ȣ Էϼ: ");
+        writeAt(5, 12, u8"5. ÷ ");
+        writeAt(5, 13, u8"6. ");
+        writeAt(5, 15, u8"ϴ  ȣ Էϼ: ");
 
-        while (!(cin >> gameMode) || gameMode < 1 || gameMode > 5) { // 1~5 Է 
+        while (!(cin >> gameMode) || gameMode < 1 || gameMode > 6) { // 1~6 Է 
             cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
-            writeAt(5, 15, string(40, ' '));
-            writeAt(5, 15, u8"1~5  ùٸ ڸ Էϼ: ");
+            writeAt(5, 16, string(40, ' '));
+            writeAt(5, 16, u8"1~6  ùٸ ڸ Էϼ: ");
         }
         cin.ignore((numeric_limits<streamsize>::max)(), '\n');
 
-        if (gameMode == 5) break; // 
+        if (gameMode == 6) break; // 
         if (gameMode == 4) {
             displayTopScores(db);
             continue; // ٽ ޴ ư
         }
+        if (gameMode == 5) {
+            displayReplays();
+            continue;
+        }
 
         //    
         int numHumanPlayers = 0, numAIPlayers = 0;
@@ -84,6 +402,18 @@ void run_yahtzee_game(GameDB& db) {
             break;
         }
 
+        // Ģ    Ѵ (Ʈ Ģ  īε ĭ ̸ )
+        int rules_choice;
+        writeAt(5, 6, u8"Ģ  (1:  13ĭ, 2: Ʈ 12ĭ): ");
+        while (!(cin >> rules_choice) || rules_choice < 1 || rules_choice > 2) {
+            cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+            writeAt(5, 7, string(40, ' '));
+            writeAt(5, 7, u8"1, 2  ϳ Էϼ: ");
+        }
+        cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+        writeAt(5, 7, string(40, ' '));
+        setRulesVariant(rules_choice == 2 ? RulesVariant::YACHT : RulesVariant::YAHTZEE);
+
         vector<Scorecard> players;
         vector<bool> is_computer;
         vector<AIDifficulty> ai_difficulties;
@@ -98,13 +428,13 @@ void run_yahtzee_game(GameDB& db) {
             is_computer.push_back(false);
         }
         for (int i = 0; i < numAIPlayers; i++) {
-            string prompt = u8"ǻ " + to_string(i + 1) + u8" ̵ (1:, 2:, 3:): ";
+            string prompt = u8"ǻ " + to_string(i + 1) + u8" ̵ (1:, 2:, 3:, 4:ºλ, 5:Ž(), 6:ܺ ): ";
             writeAt(5, current_y_prompt, prompt);
             int diff_choice;
-            while (!(cin >> diff_choice) || diff_choice < 1 || diff_choice > 3) {
+            while (!(cin >> diff_choice) || diff_choice < 1 || diff_choice > 6) {
                 cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
                 writeAt(5, current_y_prompt + 1, string(40, ' '));
-                writeAt(5, current_y_prompt + 1, u8"1, 2, 3  ϳ Էϼ: ");
+                writeAt(5, current_y_prompt + 1, u8"1~6  ϳ Էϼ: ");
             }
             cin.ignore((numeric_limits<streamsize>::max)(), '\n');
             string name = u8"ǻ" + to_string(i + 1);
@@ -114,152 +444,33 @@ void run_yahtzee_game(GameDB& db) {
             current_y_prompt += 2;
         }
 
-        Dice dice{ 1, 1, 1, 1, 1 };
-        array<bool, 5> held{};
-
-        for (int round = 1; round <= 13; ++round) {
-            for (size_t p = 0; p < players.size(); ++p) {
-                string turn_prompt = players[p].name + u8"  Դϴ. Enter Ű  ...";
-                if (is_computer[p]) turn_prompt = players[p].name + u8"  Դϴ.   մϴ...";
-                redrawAll(round, (int)p, 3, dice, held, players, turn_prompt);
-
-                if (is_computer[p]) this_thread::sleep_for(chrono::seconds(2));
-                else { string dummy; getline(cin, dummy); }
-
-                held.fill(false);
-                int rolls = 0;
-
-                redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", u8"ֻ ϴ...");
-                animateRoll(dice, held);
-                rolls++;
-
-                string statusMsg = "";
-                string errorMsg = "";
-                string combination = checkForSpecialCombinations(dice);
-                if (!combination.empty()) displayImpactEffect(combination);
-
-                bool turn_over = false;
-                while (!turn_over && rolls < 3) {
-                    if (is_computer[p]) {
-                        this_thread::sleep_for(chrono::seconds(1));
-                        AIDifficulty difficulty = ai_difficulties[p - numHumanPlayers];
-
-                        if (difficulty == AIDifficulty::EASY) {
-                            if (rolls < 3) {
-                                redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", u8"ֻ ϴ...");
-                                animateRoll(dice, held);
-                                rolls++;
-                                combination = checkForSpecialCombinations(dice);
-                                if (!combination.empty()) displayImpactEffect(combination);
-                            }
-                            else {
-                                turn_over = true;
-                            }
-                        }
-                        else {
-                            held = chooseBestHoldStrategy_Hard(dice, players[p].used, 3 - rolls, round);
-                            bool all_held = true;
-                            for (bool h : held) if (!h) { all_held = false; break; }
-                            if (all_held) {
-                                turn_over = true;
-                            }
-                            else {
-                                redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", u8"ֻ ϴ...");
-                                animateRoll(dice, held);
-                                rolls++;
-                                combination = checkForSpecialCombinations(dice);
-                                if (!combination.empty()) displayImpactEffect(combination);
-                            }
-                        }
-                    }
-                    else {
-                        string human_prompt = "[T]oggle, [R]eroll, [S]core: ";
-                        redrawAll(round, (int)p, 3 - rolls, dice, held, players, human_prompt, errorMsg, statusMsg);
-                        errorMsg = ""; statusMsg = "";
-                        string line, cmd_str; getline(cin, line);
-                        istringstream iss(line); iss >> cmd_str;
-                        char command = (cmd_str.empty()) ? ' ' : (char)toupper(cmd_str[0]);
-
-                        if (command == 'T') {
-                            size_t first_digit_pos = line.find_first_of("0123456789");
-                            if (first_digit_pos == string::npos) errorMsg = u8"߸ ɾԴϴ. (: t 1 2)";
-                            else {
-                                vector<int> indices = parseIndices(line.substr(first_digit_pos));
-                                for (int idx : indices) held[idx] = !held[idx];
-                            }
-                        }
-                        else if (command == 'R') {
-                            redrawAll(round, (int)p, 3 - rolls, dice, held, players, human_prompt, "", u8"ֻ ϴ...");
-                            animateRoll(dice, held);
-                            rolls++;
-                            combination = checkForSpecialCombinations(dice);
-                            if (!combination.empty()) displayImpactEffect(combination);
-                        }
-                        else if (command == 'S') {
-                            turn_over = true;
-                        }
-                        else {
-                            errorMsg = u8"߸ ɾԴϴ.";
-                        }
-                    }
-                }
-
-                Category chosenCat;
-                if (is_computer[p]) {
-                    redrawAll(round, (int)p, 3 - rolls, dice, held, players, "", "", players[p].name + u8"   մϴ...");
-                    this_thread::sleep_for(chrono::seconds(2));
-                    chosenCat = chooseBestScoringCategory(dice, players[p].used, round, ai_difficulties[p - numHumanPlayers]);
-                }
-                else {
-                    bool score_chosen = false; errorMsg = "";
-                    while (!score_chosen) {
-                        redrawAll(round, (int)p, 3 - rolls, dice, held, players, u8" īװ ȣ Էϼ: ", errorMsg);
-                        errorMsg = "";
-                        int cat_idx;
-                        if (cin >> cat_idx && cat_idx >= 1 && cat_idx <= 13) {
-                            chosenCat = static_cast<Category>(cat_idx - 1);
-                            if (!players[p].used[cat_idx - 1]) score_chosen = true;
-                            else errorMsg = u8"̹  īװԴϴ.";
-                        }
-                        else {
-                            errorMsg = u8"1~13  ڸ Էϼ.";
-                            cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
-                        }
-                    }
-                    cin.ignore((numeric_limits<streamsize>::max)(), '\n');
-                }
-
-                bool hadYahtzeeScored =
-                    players[p].used[static_cast<int>(Category::YAHTZEE)] &&
-                    players[p].scores[static_cast<int>(Category::YAHTZEE)] > 0;
-
-                int score = scorePreviewLine(chosenCat, dice, players[p]);
-                players[p].scores[static_cast<int>(chosenCat)] = score;
-                players[p].used[static_cast<int>(chosenCat)] = true;
-
-                if (isYahtzee(dice) && hadYahtzeeScored) {
-                    players[p].yahtzeeBonusCount++;
+        if (gameMode == 3) {
+            int view_choice;
+            writeAt(5, current_y_prompt, u8"  (1:  Ͼ , 2:  ): ");
+            while (!(cin >> view_choice) || view_choice < 1 || view_choice > 2) {
+                cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+                writeAt(5, current_y_prompt + 1, string(40, ' '));
+                writeAt(5, current_y_prompt + 1, u8"1, 2  ϳ Էϼ: ");
+            }
+            cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+            if (view_choice == 2) {
+                int games;
+                writeAt(5, current_y_prompt + 1, string(40, ' '));
+                writeAt(5, current_y_prompt + 2, u8"  Էϼ(1-1000000): ");
+                while (!(cin >> games) || games < 1 || games > 1000000) {
+                    cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+                    writeAt(5, current_y_prompt + 3, string(40, ' '));
+                    writeAt(5, current_y_prompt + 3, u8"1~1000000  ڸ Է: ");
                 }
-
-                string statusMsg2 = CAT_NAME[static_cast<int>(chosenCat)] + u8" " + to_string(score) + u8" ߽ϴ.";
-                redrawAll(round, (int)p, 0, dice, held, players, u8"Enter   ÷̾...", "", statusMsg2);
-
-                if (is_computer[p]) this_thread::sleep_for(chrono::seconds(2));
-                else { string dummy; getline(cin, dummy); }
+                cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+                vector<string> names;
+                for (const auto& pl : players) names.push_back(pl.name);
+                runFastForwardSpectator(&db, names, ai_difficulties, games, (std::max)(1, (int)thread::hardware_concurrency()));
+                continue;
             }
         }
 
-        clearScreen();
-        writeAt(5, 2, u8"==========   ==========");
-        sort(players.begin(), players.end(), [](const Scorecard& a, const Scorecard& b) { return a.total() > b.total(); });
-        int y = 4;
-        for (const auto& pl : players) {
-            db.recordScore(pl.name, pl.total()); //   
-            writeAt(5, y++, fitName(pl.name, 15) + " : " + to_string(pl.total()) + u8"");
-        }
-        writeAt(5, y + 2, u8"'" + players[0].name + u8"'  ¸Դϴ!");
-        writeAt(5, y + 4, u8"ƹ Ű  ޴ ư...");
-        cin.get();
+        playGame(db, players, is_computer, ai_difficulties, numHumanPlayers, nullptr);
     }
 
     hideCursor(false);
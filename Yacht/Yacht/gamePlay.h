@@ -19,4 +19,8 @@ using namespace std;
 //    Լ
 void run_yahtzee_game(GameDB& db);
 
+// AI  games  Ŀ 忡 ִ ӵ  ú带 ʴ 4 Ѵ ( 3   ,  --fast-forward).
+// db            Ѵ
+void runFastForwardSpectator(GameDB* db, const vector<string>& names, const vector<AIDifficulty>& seats, int games, int threads);
+
 #endif // GAMEPLAY_H
\ No newline at end of file
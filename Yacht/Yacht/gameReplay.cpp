@@ -0,0 +1,323 @@
+#include "gameReplay.h"
+#include "gameAI.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <ctime>
+#include <cstring>
+
+const char* REPLAY_FILE = "replays.yrl";
+
+static FILE* openFile(const string& path, const char* mode) {
+#ifdef _MSC_VER
+    FILE* f = nullptr;
+    return fopen_s(&f, path.c_str(), mode) == 0 ? f : nullptr;
+#else
+    return fopen(path.c_str(), mode);
+#endif
+}
+
+uint16_t packDice(const Dice& d) {
+    uint16_t v = 0;
+    for (int i = 0; i < 5; ++i) v |= static_cast<uint16_t>(d[i] << (i * 3));
+    return v;
+}
+Dice unpackDice(uint16_t packed) {
+    Dice d{};
+    for (int i = 0; i < 5; ++i) d[i] = (packed >> (i * 3)) & 7;
+    return d;
+}
+
+// ===================  ===================
+void ReplayRecorder::beginGame(uint64_t gameSeed, const vector<Scorecard>& players) {
+    buf.clear();
+    buf.reserve(4096);      // 5  ü (̺Ʈ  700Ʈ + ̸)    Ҵ  
+    buf.resize(sizeof(ReplayHeader), 0);
+    playerCount = static_cast<int>((std::min)(players.size(), static_cast<size_t>(REPLAY_MAX_PLAYERS)));
+    for (int i = 0; i < playerCount; ++i) {
+        size_t len = (std::min)(players[i].name.size(), static_cast<size_t>(255));
+        buf.push_back(static_cast<uint8_t>(len));
+        buf.insert(buf.end(), players[i].name.begin(), players[i].name.begin() + len);
+    }
+    eventsStart = buf.size();
+    roundOffset.fill(0);
+    seed = gameSeed;
+    turns = 0;
+    turnStarted = false;
+    recording = true;
+}
+
+void ReplayRecorder::roll(const array<bool, 5>& heldBefore, const Dice& dice) {
+    if (!recording) return;
+    if (!turnStarted) {
+        if (turns % playerCount == 0 && turns / playerCount < REPLAY_ROUNDS)
+            roundOffset[turns / playerCount] = static_cast<uint16_t>(buf.size() - eventsStart);
+        turnStarted = true;
+    }
+    uint8_t mask = 0;
+    for (int i = 0; i < 5; ++i) if (heldBefore[i]) mask |= static_cast<uint8_t>(1 << i);
+    uint16_t packed = packDice(dice);
+    buf.push_back(static_cast<uint8_t>((REPLAY_EV_ROLL << 5) | mask));
+    buf.push_back(static_cast<uint8_t>(packed & 0xFF));
+    buf.push_back(static_cast<uint8_t>(packed >> 8));
+}
+
+void ReplayRecorder::score(Category cat, int score, bool yahtzeeBonus) {
+    if (!recording) return;
+    buf.push_back(static_cast<uint8_t>((REPLAY_EV_SCORE << 5) | (yahtzeeBonus ? 0x10 : 0) | static_cast<int>(cat)));
+    buf.push_back(static_cast<uint8_t>(score));
+    turns++;
+    turnStarted = false;
+}
+
+void ReplayRecorder::endGame(const vector<Scorecard>& players, ReplayWriter& writer) {
+    if (!recording) return;
+    ReplayHeader h{};
+    h.magic = REPLAY_MAGIC;
+    h.version = static_cast<uint8_t>(1 | static_cast<int>(rulesVariant()) << 4);
+    h.playerCount = static_cast<uint8_t>(playerCount);
+    h.namesBytes = static_cast<uint16_t>(eventsStart - sizeof(ReplayHeader));
+    h.seed = seed;
+    h.timestamp = static_cast<uint64_t>(time(nullptr));
+    h.eventBytes = static_cast<uint32_t>(buf.size() - eventsStart);
+    for (int r = 0; r < REPLAY_ROUNDS; ++r) h.roundOffset[r] = roundOffset[r];
+    for (int i = 0; i < playerCount; ++i) h.totals[i] = static_cast<int16_t>(players[i].total());
+    memcpy(buf.data(), &h, sizeof(h));
+    writer.append(move(buf));
+    buf = vector<uint8_t>();
+    recording = false;
+}
+
+void ReplayRecorder::endGame(const vector<Scorecard>& players) {
+    endGame(players, ReplayWriter::instance());
+}
+
+ReplayWriter& ReplayWriter::instance() {
+    static ReplayWriter writer(REPLAY_FILE);
+    return writer;
+}
+
+ReplayWriter::ReplayWriter(const string& p) : path(p) {
+    worker = thread(&ReplayWriter::run, this);
+}
+
+ReplayWriter::~ReplayWriter() {
+    {
+        lock_guard<mutex> lock(mtx);
+        stopping = true;
+    }
+    cv.notify_all();
+    if (worker.joinable()) worker.join();
+    if (file) fclose(file);
+}
+
+void ReplayWriter::append(vector<uint8_t>&& record) {
+    {
+        lock_guard<mutex> lock(mtx);
+        queue.push_back(move(record));
+    }
+    cv.notify_one();
+}
+
+void ReplayWriter::flush() {
+    unique_lock<mutex> lock(mtx);
+    drained.wait(lock, [&]() { return queue.empty() && !writing; });
+}
+
+void ReplayWriter::run() {
+    deque<vector<uint8_t>> batch;
+    unique_lock<mutex> lock(mtx);
+    while (true) {
+        cv.wait(lock, [&]() { return stopping || !queue.empty(); });
+        if (queue.empty() && stopping) break;
+        batch.swap(queue);
+        writing = true;
+        lock.unlock();
+
+        if (!file) {
+            file = openFile(path, "ab");
+            if (file) setvbuf(file, nullptr, _IOFBF, 1 << 20);
+        }
+        if (file) {
+            for (const auto& rec : batch) fwrite(rec.data(), 1, rec.size(), file);
+            fflush(file);
+        }
+        batch.clear();
+
+        lock.lock();
+        writing = false;
+        drained.notify_all();
+    }
+}
+
+// =================== б ===================
+ReplayReader::~ReplayReader() { close(); }
+
+bool ReplayReader::open(const string& path) {
+    close();
+    file = openFile(path, "rb");
+    if (!file) return false;
+    buf.resize(1 << 20);
+    head = tail = 0;
+    consumed = 0;
+    return true;
+}
+
+void ReplayReader::close() {
+    if (file) { fclose(file); file = nullptr; }
+}
+
+bool ReplayReader::fill(size_t need) {
+    if (tail - head >= need) return true;
+    if (!file) return false;
+    if (head > 0) {
+        memmove(buf.data(), buf.data() + head, tail - head);
+        tail -= head;
+        head = 0;
+    }
+    if (buf.size() < need) buf.resize(need);
+    while (tail < need) {
+        size_t n = fread(buf.data() + tail, 1, buf.size() - tail, file);
+        if (n == 0) return false;
+        tail += n;
+    }
+    return true;
+}
+
+bool ReplayReader::next(ReplayGame& game) {
+    if (!fill(sizeof(ReplayHeader))) return false;
+    memcpy(&game.header, buf.data() + head, sizeof(ReplayHeader));
+    const ReplayHeader& h = game.header;
+    if (h.magic != REPLAY_MAGIC || h.playerCount == 0 || h.playerCount > REPLAY_MAX_PLAYERS) return false;
+    size_t total = sizeof(ReplayHeader) + h.namesBytes + h.eventBytes;
+    if (!fill(total)) return false;
+
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(buf.data() + head) + sizeof(ReplayHeader);
+    const uint8_t* namesEnd = p + h.namesBytes;
+    game.names.resize(h.playerCount);
+    for (int i = 0; i < h.playerCount; ++i) {
+        size_t len = (p < namesEnd) ? *p++ : 0;
+        if (p + len > namesEnd) return false;
+        game.names[i].assign(reinterpret_cast<const char*>(p), len);
+        p += len;
+    }
+    game.events.assign(namesEnd, namesEnd + h.eventBytes);
+    game.fileOffset = consumed;
+    consumed += total;
+    head += total;
+    return true;
+}
+
+bool ReplayReader::decodeTurns(const ReplayGame& game, int fromRound, vector<ReplayTurn>& out) {
+    out.clear();
+    const int pc = game.header.playerCount;
+    if (fromRound < 1) fromRound = 1;
+    if (fromRound > REPLAY_ROUNDS || pc == 0) return false;
+    size_t pos = game.header.roundOffset[fromRound - 1];
+    if (fromRound > 1 && pos == 0) return false;
+    int turnIndex = (fromRound - 1) * pc;
+
+    ReplayTurn cur;
+    const vector<uint8_t>& ev = game.events;
+    while (pos < ev.size()) {
+        uint8_t b = ev[pos];
+        switch (b >> 5) {
+        case REPLAY_EV_ROLL:
+            if (pos + 3 > ev.size() || cur.rollCount >= 3) return false;
+            cur.heldBefore[cur.rollCount] = b & 0x1F;
+            cur.dice[cur.rollCount] = unpackDice(static_cast<uint16_t>(ev[pos + 1] | (ev[pos + 2] << 8)));
+            cur.rollCount++;
+            pos += 3;
+            break;
+        case REPLAY_EV_SCORE:
+            if (pos + 2 > ev.size()) return false;
+            cur.category = static_cast<Category>(b & 0x0F);
+            cur.yahtzeeBonus = (b & 0x10) != 0;
+            cur.score = ev[pos + 1];
+            cur.round = turnIndex / pc + 1;
+            cur.player = turnIndex % pc;
+            out.push_back(cur);
+            cur = ReplayTurn();
+            turnIndex++;
+            pos += 2;
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+// =================== ġũ ===================
+void runReplayBenchmark(int games, int copies) {
+    if (games < 1) games = 1;
+    if (copies < 1) copies = 1;
+    const string path = "replay_bench.yrl";
+    remove(path.c_str());
+
+    //  AI 2    ,  copies   ū α׸ 
+    uint64_t recordNs = 0;
+    {
+        ReplayWriter sink(path);
+        for (int g = 0; g < games; ++g) {
+            vector<Scorecard> players{ Scorecard(u8"ǻ1"), Scorecard(u8"ǻ2") };
+            ReplayRecorder rec;
+            uint64_t seed = (static_cast<uint64_t>(random_device{}()) << 32) | random_device{}();
+            seedRng(seed);
+            rec.beginGame(seed, players);
+            Dice dice{ 1, 1, 1, 1, 1 };
+            for (int round = 1; round <= 13; ++round)
+                for (auto& sc : players) playAITurn(sc, dice, round, AIDifficulty::EASY, &rec);
+            auto t0 = chrono::steady_clock::now();
+            rec.endGame(players, sink);
+            recordNs += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+        }
+        sink.flush();
+    }
+
+    vector<uint8_t> original;
+    if (FILE* f = openFile(path, "rb")) {
+        uint8_t chunk[65536];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) original.insert(original.end(), chunk, chunk + n);
+        fclose(f);
+    }
+    const uint64_t totalBytes = original.size();
+    if (FILE* f = openFile(path, "ab")) {
+        for (int c = 1; c < copies; ++c) fwrite(original.data(), 1, original.size(), f);
+        fclose(f);
+    }
+    const uint64_t totalGames = static_cast<uint64_t>(games) * copies;
+    cout << u8"Ӵ Ʈ: " << fixed << setprecision(1) << static_cast<double>(totalBytes) / games
+        << u8" ( " << sizeof(ReplayHeader) << u8"),  Ϸ ó " << setprecision(0) << static_cast<double>(recordNs) / games << " ns/game" << endl;
+
+    auto timed = [&](const char* label, int mode) {
+        ReplayReader r;
+        ReplayGame g;
+        vector<ReplayTurn> turns;
+        uint64_t n = 0, turnCount = 0, yahtzees = 0; long long sum = 0;
+        auto t0 = chrono::steady_clock::now();
+        if (r.open(path)) {
+            while (r.next(g)) {
+                n++;
+                sum += g.header.totals[0];
+                if (mode == 1 && ReplayReader::decodeTurns(g, 1, turns)) {
+                    turnCount += turns.size();
+                    for (const auto& t : turns) if (t.category == Category::YAHTZEE && t.score > 0) yahtzees++;
+                }
+                if (mode == 2 && ReplayReader::decodeTurns(g, 13, turns)) turnCount += turns.size();
+            }
+        }
+        double sec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        cout << setw(22) << left << label << right << setw(10) << n << u8" " << setw(12) << setprecision(0) << n / sec << " games/s";
+        if (mode) cout << setw(14) << turnCount / sec << " turns/s";
+        if (mode == 1) cout << u8"  Ʈ  " << setprecision(3) << static_cast<double>(yahtzees) / (n ? n * 2 : 1);
+        cout << u8"    " << setprecision(1) << static_cast<double>(sum) / (n ? n : 1) << endl;
+    };
+    cout << u8"ڵ " << totalGames << u8",  " << setprecision(1) << totalBytes * static_cast<double>(copies) / (1 << 20) << " MB" << endl;
+    timed(u8" ĵ", 0);
+    timed(u8"ü  ؼ", 1);
+    timed(u8"13 ̵", 2);
+    remove(path.c_str());
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#ifndef GAMEREPLAY_H
+#define GAMEREPLAY_H
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// =================== ÷   ===================
+//  =  ڵ . ڵ = [  64Ʈ][̸][̺Ʈ Ʈ]
+//  ̸: ÷̾ u8  + UTF-8 Ʈ
+//  ̺Ʈ: ù Ʈ  3Ʈ 
+//   ROLL  (3Ʈ) [| Ȧ ũ 5Ʈ][u16 ֻ 5 x 3Ʈ]
+//   SCORE (2Ʈ) [|Ʈ ʽ 1Ʈ|īװ 4Ʈ][u8 ]
+//    帶 ÷̾ 0..n-1 ̹Ƿ ÷̾ ȣ  ʴ´
+//   Ʈ ʵ Ʋ 
+extern const char* REPLAY_FILE;
+
+constexpr uint32_t REPLAY_MAGIC = 0x31505259;   // "YRP1"
+constexpr int REPLAY_MAX_PLAYERS = 5;
+constexpr int REPLAY_ROUNDS = 13;
+
+#pragma pack(push, 1)
+struct ReplayHeader {
+    uint32_t magic;
+    uint8_t version;                                //  4Ʈ =  (1),  4Ʈ = RulesVariant
+    uint8_t playerCount;
+    uint16_t namesBytes;
+    uint64_t seed;                                  // seedRng   64Ʈ õ
+    uint64_t timestamp;                             // н ð()
+    uint32_t eventBytes;
+    uint16_t roundOffset[REPLAY_ROUNDS];            //  ù ̺Ʈ ̺Ʈ Ʈ  ġ
+    int16_t totals[REPLAY_MAX_PLAYERS];             // ¼   
+};
+#pragma pack(pop)
+static_assert(sizeof(ReplayHeader) == 64, "ReplayHeader  64Ʈ ");
+
+inline RulesVariant replayRules(const ReplayHeader& h) { return static_cast<RulesVariant>(h.version >> 4); }
+
+enum ReplayEvent : uint8_t { REPLAY_EV_ROLL = 1, REPLAY_EV_SCORE = 2 };
+
+// ===================  ===================
+class ReplayWriter;
+
+//  ߿ ޸ ۿ Ʈ ̰,  ڵ带 ° ׶ ϱ⿡ ѱ
+class ReplayRecorder {
+public:
+    void beginGame(uint64_t seed, const vector<Scorecard>& players);
+    void roll(const array<bool, 5>& heldBefore, const Dice& dice);
+    void score(Category cat, int score, bool yahtzeeBonus);
+    void endGame(const vector<Scorecard>& players, ReplayWriter& writer);  //    ϱ 
+    void endGame(const vector<Scorecard>& players);
+    bool active() const { return recording; }
+
+private:
+    vector<uint8_t> buf;
+    size_t eventsStart = 0;
+    array<uint16_t, REPLAY_ROUNDS> roundOffset{};
+    uint64_t seed = 0;
+    int playerCount = 1;
+    int turns = 0;
+    bool turnStarted = false;
+    bool recording = false;
+};
+
+// ڵ带   忡   δ (  ť ֱ⸸ )
+class ReplayWriter {
+public:
+    static ReplayWriter& instance();
+    explicit ReplayWriter(const string& path);
+    ~ReplayWriter();
+    void append(vector<uint8_t>&& record);
+    void flush();                                       // ť   
+
+private:
+    string path;
+    FILE* file = nullptr;
+    deque<vector<uint8_t>> queue;
+    mutex mtx;
+    condition_variable cv, drained;
+    bool stopping = false;
+    bool writing = false;
+    thread worker;
+    void run();
+};
+
+// =================== б ===================
+struct ReplayGame {
+    ReplayHeader header{};
+    vector<string> names;
+    vector<uint8_t> events;
+    uint64_t fileOffset = 0;
+};
+
+struct ReplayTurn {
+    int round = 1;
+    int player = 0;
+    int rollCount = 0;
+    array<uint8_t, 3> heldBefore{};                 //    Ȧ ũ
+    array<Dice, 3> dice{};
+    Category category = Category::CATEGORY_COUNT;
+    int score = 0;
+    bool yahtzeeBonus = false;
+};
+
+// ū ۷  б. next  ReplayGame  ۸ Ѵ
+class ReplayReader {
+public:
+    ~ReplayReader();
+    bool open(const string& path);
+    bool next(ReplayGame& game);
+    void close();
+
+    // fromRound   out  ä (roundOffset  ٷ ̵)
+    static bool decodeTurns(const ReplayGame& game, int fromRound, vector<ReplayTurn>& out);
+
+private:
+    FILE* file = nullptr;
+    vector<char> buf;
+    size_t head = 0, tail = 0;
+    uint64_t consumed = 0;
+    bool fill(size_t need);
+};
+
+uint16_t packDice(const Dice& d);
+Dice unpackDice(uint16_t packed);
+
+//  ũ/Ľ ӵ  ( --bench-replay)
+void runReplayBenchmark(int games, int copies);
+
+#endif // GAMEREPLAY_H
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "gameReroll.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace dicetab;
+
+void RerollMatrix::expect(const double* handValue, double* keepOut) const {
+    for (int k = 0; k < rows(); ++k) {
+        double s = 0;
+        for (int i = offset[k]; i < offset[k + 1]; ++i) s += prob[i] * handValue[hand[i]];
+        keepOut[k] = s;
+    }
+}
+
+void RerollMatrix::bestKeep(const double* keepValue, double* handOut, uint16_t* bestKeepOut) {
+    for (int h = 0; h < HAND_COUNT; ++h) {
+        const uint16_t* sub = SUBKEEPS.keeps[h].data();
+        uint16_t arg = sub[0];
+        double best = keepValue[arg];
+        for (int i = 1; i < SUBKEEPS.count[h]; ++i) if (keepValue[sub[i]] > best) { best = keepValue[sub[i]]; arg = sub[i]; }
+        handOut[h] = best;
+        if (bestKeepOut) bestKeepOut[h] = arg;
+    }
+}
+
+void RerollMatrix::expect2(const double* handValue, double* keep1, double* keep2) const {
+    double v1[HAND_COUNT];
+    expect(handValue, keep1);
+    bestKeep(keep1, v1);
+    expect(v1, keep2);
+}
+
+void RerollMatrix::expectRolls(const double* handValue, int rolls, double* keepOut) const {
+    if (rolls <= 1) { expect(handValue, keepOut); return; }
+    double v1[HAND_COUNT];
+    expect(handValue, keepOut);
+    bestKeep(keepOut, v1);
+    expect(v1, keepOut);
+}
+
+// ===================    ===================
+//   ʰ  ֻ  ִ 6^n      
+static Dice diceOfKeep(const FaceCounts& keep, int& n) {
+    Dice d{};
+    n = 0;
+    for (int f = 0; f < 6; ++f) for (int c = 0; c < keep[f]; ++c) d[n++] = f + 1;
+    return d;
+}
+
+static int handOfDice(const Dice& d) {
+    FaceCounts c{};
+    for (int v : d) c[v - 1]++;
+    return handIndex(c);
+}
+
+template <typename Visit>
+static void forEachRoll(const FaceCounts& keep, Visit visit) {
+    int n;
+    Dice d = diceOfKeep(keep, n);
+    const int m = 5 - n;
+    int total = 1;
+    for (int i = 0; i < m; ++i) total *= 6;
+    for (int code = 0; code < total; ++code) {
+        int c = code;
+        for (int i = n; i < 5; ++i) { d[i] = c % 6 + 1; c /= 6; }
+        visit(d, total);
+    }
+}
+
+static void bruteExpect1(const double* value, double* out) {
+    for (int k = 0; k < KEEP_COUNT; ++k) {
+        double s = 0;
+        forEachRoll(KEEP_FACES[k], [&](const Dice& d, int total) { s += value[handOfDice(d)] / total; });
+        out[k] = s;
+    }
+}
+
+//   : ù  ֻ ġ 32 Ȧ带  õ ( °  bruteExpect1  )
+static void bruteExpect2(const double* value, double* out) {
+    vector<double> once(KEEP_COUNT);
+    bruteExpect1(value, once.data());
+    for (int k = 0; k < KEEP_COUNT; ++k) {
+        double s = 0;
+        forEachRoll(KEEP_FACES[k], [&](const Dice& d, int total) {
+            double best = -1e300;
+            for (int mask = 0; mask < 32; ++mask) {
+                FaceCounts kept{};
+                for (int i = 0; i < 5; ++i) if (mask >> i & 1) kept[d[i] - 1]++;
+                best = (std::max)(best, once[keepIndex(kept)]);
+            }
+            s += best / total;
+        });
+        out[k] = s;
+    }
+}
+
+static double maxAbsDiff(const double* a, const double* b, int n) {
+    double m = 0;
+    for (int i = 0; i < n; ++i) m = (std::max)(m, fabs(a[i] - b[i]));
+    return m;
+}
+
+void runRerollBenchmark(int iterations) {
+    if (iterations < 1) iterations = 1;
+    const RerollMatrix& mx = REROLL_MATRIX;
+
+    //  : 13 īװ  +   3
+    vector<vector<double>> values;
+    for (int c = 0; c < CAT_N; ++c) {
+        vector<double> v(HAND_COUNT);
+        for (int h = 0; h < HAND_COUNT; ++h) v[h] = HAND_SCORES[h][c];
+        values.push_back(v);
+    }
+    for (int r = 0; r < 3; ++r) {
+        vector<double> v(HAND_COUNT);
+        for (auto& x : v) x = static_cast<double>(g_rng() % 100000) / 1000.0 - 50.0;
+        values.push_back(v);
+    }
+
+    double err1 = 0, err2 = 0;
+    double k1[KEEP_COUNT], k2[KEEP_COUNT], b1[KEEP_COUNT], b2[KEEP_COUNT];
+    auto v0 = chrono::steady_clock::now();
+    for (const auto& v : values) {
+        mx.expect2(v.data(), k1, k2);
+        bruteExpect1(v.data(), b1);
+        bruteExpect2(v.data(), b2);
+        err1 = (std::max)(err1, maxAbsDiff(k1, b1, KEEP_COUNT));
+        err2 = (std::max)(err2, maxAbsDiff(k2, b2, KEEP_COUNT));
+    }
+    double bruteMs = chrono::duration<double, milli>(chrono::steady_clock::now() - v0).count();
+    const bool ok = err1 < 1e-9 && err2 < 1e-9;
+
+    // ü  밪 (  ϳ -> 462 밪)
+    double checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        mx.expect(values[i % values.size()].data(), k1);
+        checksum += k1[i % KEEP_COUNT];
+    }
+    double sec1 = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    t0 = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        mx.expect2(values[i % values.size()].data(), k1, k2);
+        checksum += k2[i % KEEP_COUNT];
+    }
+    double sec2 = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    // :  AI  2000ȸ ǥ  keep ϳ    밪 
+    const int SAMPLES = 2000;
+    const int mcCount = (std::max)(1, iterations / 10);
+    double mcErr = 0;
+    t0 = chrono::steady_clock::now();
+    for (int i = 0; i < mcCount; ++i) {
+        int k = static_cast<int>(g_rng() % KEEP_COUNT);
+        const double* v = values[i % values.size()].data();
+        int n;
+        Dice base = diceOfKeep(KEEP_FACES[k], n);
+        double s = 0;
+        for (int j = 0; j < SAMPLES; ++j) {
+            Dice d = base;
+            for (int p = n; p < 5; ++p) d[p] = roll6();
+            s += v[handOfDice(d)];
+        }
+        mcErr = (std::max)(mcErr, fabs(s / SAMPLES - mx.expect(k, v)));
+    }
+    double secMc = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    cout << fixed << setprecision(3)
+        << u8" : " << mx.rows() << " x " << mx.cols() << u8", 0 ƴ ĭ " << mx.nonZeros() << endl
+        << u8"   (  " << values.size() << u8", " << bruteMs << " ms): "
+        << (ok ? u8"ġ" : u8"ġ") << setprecision(2) << scientific << u8" (ִ  1ȸ " << err1 << u8", 2ȸ " << err2 << ")" << endl
+        << fixed << setprecision(0)
+        << u8"  : " << iterations * static_cast<double>(KEEP_COUNT) / sec1 << u8" 밪/ ("
+        << iterations / sec1 << u8"  /)" << endl
+        << u8"  : " << iterations * static_cast<double>(KEEP_COUNT) / sec2 << u8" 밪/ ("
+        << iterations / sec2 << u8"  /)" << endl
+        << u8" - ǥ " << SAMPLES << u8"ȸ : " << mcCount / secMc << u8" 밪/, ִ  " << setprecision(3) << mcErr
+        << u8" ( " << setprecision(1) << checksum << ")" << endl;
+}
\ No newline at end of file
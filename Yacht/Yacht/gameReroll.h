@@ -0,0 +1,59 @@
+#pragma once
+#ifndef GAMEREROLL_H
+#define GAMEREROLL_H
+
+#include <cstdint>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// =================== ٽ    ===================
+//  =  (keep 462),  =  (hand 252),  =      Ȯ  Ȯ
+// CSR :  k  0 ƴ ĭ [offset[k], offset[k+1])  hand/prob ( 迭,  4368ĭ)
+// ʹ dicetab::REROLL ( ð ǥ)  ״ ŰǷ 糪 ʱȭ  
+//
+// " " =  ո ϳ  (: īװ ). 밪 Լ   ͸ ޾
+//  ո 밪 ä.    ù  ڿ     ּ ٰ 
+class RerollMatrix {
+public:
+    constexpr RerollMatrix(const uint16_t* offset, const uint8_t* hand, const double* prob)
+        : offset(offset), hand(hand), prob(prob) {}
+
+    static constexpr int rows() { return dicetab::KEEP_COUNT; }
+    static constexpr int cols() { return dicetab::HAND_COUNT; }
+    int nonZeros() const { return offset[rows()]; }
+    int rowBegin(int keep) const { return offset[keep]; }
+    int rowEnd(int keep) const { return offset[keep + 1]; }
+    int outcome(int i) const { return hand[i]; }
+    double probability(int i) const { return prob[i]; }
+
+    //   : keepOut[k] = sum p(k -> h) * handValue[h]
+    double expect(int keep, const double* handValue) const {
+        double s = 0;
+        for (int i = offset[keep]; i < offset[keep + 1]; ++i) s += prob[i] * handValue[hand[i]];
+        return s;
+    }
+    void expect(const double* handValue, double* keepOut) const;
+
+    //  ո  տ   ִ κ     : handOut[h] = max_{k  h} keepValue[k]
+    // bestKeepOut   ִ ִ keep ȣ ä
+    static void bestKeep(const double* keepValue, double* handOut, uint16_t* bestKeepOut = nullptr);
+
+    //   : keep1 =    밪, keep2 =  ּ       밪
+    void expect2(const double* handValue, double* keep1, double* keep2) const;
+    // rolls (1 Ǵ 2)  밪. 2 ̸ ߰  ͸  keepOut  ӽ÷ Ѵ
+    void expectRolls(const double* handValue, int rolls, double* keepOut) const;
+
+private:
+    const uint16_t* offset;
+    const uint8_t* hand;
+    const double* prob;
+};
+
+inline constexpr RerollMatrix REROLL_MATRIX{ dicetab::REROLL.offset.data(), dicetab::REROLL.hand.data(), dicetab::REROLL.prob.data() };
+
+//  ( ִ 6^n )    ʴ 밪    ( --bench-reroll)
+void runRerollBenchmark(int iterations);
+
+#endif // GAMEREROLL_H
\ No newline at end of file
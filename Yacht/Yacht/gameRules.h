@@ -0,0 +1,249 @@
+#pragma once
+#ifndef GAMERULES_H
+#define GAMERULES_H
+
+#include <array>
+#include <cstdint>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// =================== Ģ å ===================
+// Ģ ϳ =   ü (ֻ ,  , ĭ , , ʽ).
+//  Ŀΰ AI ǥ å ø ڷ ޾ Ģ  Ƿ Ŀ ȿ Ģ бⰡ .
+//   (RulesVariant)  Լ Ա withRules    
+namespace rules {
+
+template <int DICE_N, int FACE_N>
+struct DiceShape {
+    static constexpr int DICE = DICE_N;
+    static constexpr int FACES = FACE_N;
+    static constexpr int HANDS = dicetab::binom(DICE_N + FACE_N - 1, DICE_N);   //    
+};
+
+constexpr int bit(Category c) { return 1 << static_cast<int>(c); }
+
+//  (Yahtzee): 13ĭ, ǮϿ콺/ƮƮ  ,  ʽ Ŀ Ģ
+struct YahtzeeRules : DiceShape<5, 6> {
+    static constexpr RulesVariant VARIANT = RulesVariant::YAHTZEE;
+    static constexpr uint16_t ACTIVE = 0x1FFF;
+    static constexpr int UPPER_BONUS_THRESHOLD = 63;
+    static constexpr int UPPER_BONUS = 35;
+    static constexpr int FULL_HOUSE = 25;                   // 0 = ֻ 
+    static constexpr int SMALL_STRAIGHT = 30;
+    static constexpr int LARGE_STRAIGHT = 40;
+    static constexpr int YACHT = 50;
+    static constexpr bool FOUR_KIND_MATCHING_ONLY = false;  // true =   4 , false = ֻ ü 
+    static constexpr bool YACHT_BONUS_AND_JOKER = true;
+};
+
+// Ʈ (ŬϿ콺/ѱ Ʈ ̽): īε  12ĭ, īε =   4 ,
+// ǮϿ콺 = ֻ , ƮƮ 15/30, Ʈ ʽ/Ŀ 
+struct YachtRules : DiceShape<5, 6> {
+    static constexpr RulesVariant VARIANT = RulesVariant::YACHT;
+    static constexpr uint16_t ACTIVE = 0x1FFF & ~bit(Category::THREE_KIND);
+    static constexpr int UPPER_BONUS_THRESHOLD = 63;
+    static constexpr int UPPER_BONUS = 35;
+    static constexpr int FULL_HOUSE = 0;
+    static constexpr int SMALL_STRAIGHT = 15;
+    static constexpr int LARGE_STRAIGHT = 30;
+    static constexpr int YACHT = 50;
+    static constexpr bool FOUR_KIND_MATCHING_ONLY = true;
+    static constexpr bool YACHT_BONUS_AND_JOKER = false;
+};
+
+// Ÿ  -> å Ÿ. fn  å ü ϳ ޴ ׸  ([&](auto r) { using R = decltype(r); ... })
+template <class Fn>
+inline auto withRules(RulesVariant v, Fn&& fn) {
+    switch (v) {
+    case RulesVariant::YACHT: return fn(YachtRules{});
+    default: return fn(YahtzeeRules{});
+    }
+}
+
+// ===================  Ŀ ===================
+template <class R>
+struct Kernel {
+    static_assert(R::FACES >= 1 && R::FACES <= 6, " īװ 1~6  ֽϴ");
+    static_assert(R::DICE >= 5, "ƮƮ/īε  ֻ 5 ̻ ʿմϴ");
+    static constexpr int CAT_N = static_cast<int>(Category::CATEGORY_COUNT);
+
+    static constexpr bool active(Category c) { return (R::ACTIVE & bit(c)) != 0; }
+    static constexpr int upperBonus(int upperSum) { return (upperSum >= R::UPPER_BONUS_THRESHOLD) * R::UPPER_BONUS; }
+    static constexpr int activeCount() {
+        int n = 0;
+        for (int c = 0; c < CAT_N; ++c) n += (R::ACTIVE >> c) & 1;
+        return n;
+    }
+
+    //  (cnt[f] =  f+1  ) -> 13ĭ .   (0/1)  Ƿ бⰡ  (ǥ )
+    static constexpr void scoreCounts(const uint8_t* cnt, int* out) {
+        int sum = 0, maxCount = 0, maxFace = 0, mask = 0, has3 = 0, has2 = 0;
+        for (int f = 0; f < R::FACES; ++f) {
+            const int c = cnt[f];
+            const int more = c >= maxCount;
+            sum += c * (f + 1);
+            maxFace = more * (f + 1) + (1 - more) * maxFace;
+            maxCount = more * c + (1 - more) * maxCount;
+            mask |= (c > 0) << f;
+            has3 |= c == 3;
+            has2 |= c == 2;
+        }
+        const int run4 = (mask & mask >> 1 & mask >> 2 & mask >> 3) != 0;
+        const int run5 = (mask & mask >> 1 & mask >> 2 & mask >> 3 & mask >> 4) != 0;
+
+        for (int f = 0; f < 6; ++f) out[f] = f < R::FACES ? cnt[f] * (f + 1) : 0;
+        out[static_cast<int>(Category::THREE_KIND)] = active(Category::THREE_KIND) * (maxCount >= 3) * sum;
+        out[static_cast<int>(Category::FOUR_KIND)] = active(Category::FOUR_KIND) * (maxCount >= 4) * (R::FOUR_KIND_MATCHING_ONLY ? 4 * maxFace : sum);
+        out[static_cast<int>(Category::FULL_HOUSE)] = active(Category::FULL_HOUSE) * (has3 & has2) * (R::FULL_HOUSE ? R::FULL_HOUSE : sum);
+        out[static_cast<int>(Category::SMALL_STRAIGHT)] = active(Category::SMALL_STRAIGHT) * run4 * R::SMALL_STRAIGHT;
+        out[static_cast<int>(Category::LARGE_STRAIGHT)] = active(Category::LARGE_STRAIGHT) * run5 * R::LARGE_STRAIGHT;
+        out[static_cast<int>(Category::YAHTZEE)] = active(Category::YAHTZEE) * (maxCount == R::DICE) * R::YACHT;
+        out[static_cast<int>(Category::CHANCE)] = active(Category::CHANCE) * sum;
+    }
+
+    static constexpr void countDice(const int* dice, uint8_t* cnt) {
+        for (int f = 0; f < R::FACES; ++f) cnt[f] = 0;
+        for (int i = 0; i < R::DICE; ++i) cnt[dice[i] - 1]++;
+    }
+    //   13ĭ   (     ä)
+    static constexpr void scoreAll(const int* dice, int* out) {
+        uint8_t cnt[R::FACES] = {};
+        countDice(dice, cnt);
+        scoreCounts(cnt, out);
+    }
+
+    // īװ ϳ.   4Ʈ    (packed), "k ̻"/"Ȯ k"
+    // Ϻ  / ֻ Ʈ Ѳ Ѵ (ֻ 7 Ϻ ġ )
+    static constexpr int score(Category c, const int* dice) {
+        static_assert(R::DICE <= 7, "Ϻ    ִ 7");
+        constexpr uint32_t ONES = 0x111111u & ((1u << (4 * R::FACES)) - 1);
+        constexpr uint32_t HIGH = ONES * 8;
+        uint32_t packed = 0;
+        int sum = 0, mask = 0;
+        for (int i = 0; i < R::DICE; ++i) {
+            packed += 1u << (4 * (dice[i] - 1));
+            sum += dice[i];
+            mask |= 1 << (dice[i] - 1);
+        }
+        const int ci = static_cast<int>(c);
+        if (ci <= static_cast<int>(Category::SIXES)) return static_cast<int>(packed >> (4 * ci) & 15) * (ci + 1);
+        auto atLeast = [packed](int k) -> int { return ((packed + ONES * (8 - k)) & HIGH) != 0; };
+        auto exactly = [packed](int k) -> int {
+            const uint32_t x = packed ^ (ONES * k);     //  k  Ϻ 0
+            return ((x - ONES) & ~x & HIGH) != 0;
+        };
+        const int run4 = (mask & mask >> 1 & mask >> 2 & mask >> 3) != 0;
+        const int run5 = (mask & mask >> 1 & mask >> 2 & mask >> 3 & mask >> 4) != 0;
+        switch (c) {
+        case Category::THREE_KIND: return active(c) * atLeast(3) * sum;
+        case Category::FOUR_KIND:
+            if constexpr (R::FOUR_KIND_MATCHING_ONLY) {
+                const uint32_t t = (packed + ONES * 4) & HIGH;  // 4 ̻  ϳ
+                int face = 0;
+                for (int f = 0; f < R::FACES; ++f) face += static_cast<int>(t >> (4 * f + 3) & 1) * (f + 1);
+                return active(c) * 4 * face;
+            }
+            else {
+                return active(c) * atLeast(4) * sum;
+            }
+        case Category::FULL_HOUSE: return active(c) * (exactly(3) & exactly(2)) * (R::FULL_HOUSE ? R::FULL_HOUSE : sum);
+        case Category::SMALL_STRAIGHT: return active(c) * run4 * R::SMALL_STRAIGHT;
+        case Category::LARGE_STRAIGHT: return active(c) * run5 * R::LARGE_STRAIGHT;
+        case Category::YAHTZEE: return active(c) * atLeast(R::DICE) * R::YACHT;
+        case Category::CHANCE: return active(c) * sum;
+        default: return 0;
+        }
+    }
+
+    // Ŀ: ߸ ̹ 50 ߰  ߰  ϴ ĭ   ä  ִ
+    static constexpr int scoreWithJoker(Category c, const int* dice, bool yachtScored, bool upperOfFaceUsed) {
+        const int base = score(c, dice);
+        if constexpr (!R::YACHT_BONUS_AND_JOKER) {
+            return base;
+        }
+        else {
+            bool yacht = true;
+            for (int i = 1; i < R::DICE; ++i) yacht = yacht && dice[i] == dice[0];
+            if (!yacht || !yachtScored) return base;
+            switch (c) {
+            case Category::FULL_HOUSE: return R::FULL_HOUSE ? R::FULL_HOUSE : base;
+            case Category::SMALL_STRAIGHT: return R::SMALL_STRAIGHT;
+            case Category::LARGE_STRAIGHT: return R::LARGE_STRAIGHT;
+            case Category::ONES: case Category::TWOS: case Category::THREES: case Category::FOURS: case Category::FIVES: case Category::SIXES:
+                return upperOfFaceUsed ? base : dice[0] * R::DICE;
+            default: return base;
+            }
+        }
+    }
+};
+
+// =================== Ģ AI ǥ ===================
+//   (hand)    13ĭ . ȣ dicetab   ռ ü
+template <class R>
+struct HandTable {
+    array<array<uint8_t, R::FACES>, R::HANDS> faces{};
+    array<array<uint8_t, static_cast<size_t>(Category::CATEGORY_COUNT)>, R::HANDS> scores{};
+};
+
+template <class R>
+constexpr int handRank(const uint8_t* cnt) {
+    int r = 0, i = 0;
+    for (int f = 0; f < R::FACES; ++f)
+        for (int k = 0; k < cnt[f]; ++k, ++i) r += dicetab::binom(f + i, i + 1);
+    return r;
+}
+
+template <class R>
+constexpr HandTable<R> makeHandTable() {
+    HandTable<R> t{};
+    int a[R::DICE] = {};                    // ĵ  (0 )
+    for (int n = 0; n < R::HANDS; ++n) {
+        uint8_t cnt[R::FACES] = {};
+        for (int i = 0; i < R::DICE; ++i) cnt[a[i]]++;
+        const int h = handRank<R>(cnt);
+        int all[Kernel<R>::CAT_N] = {};
+        Kernel<R>::scoreCounts(cnt, all);
+        uint8_t* faces = t.faces[h].data();
+        uint8_t* scores = t.scores[h].data();
+        for (int f = 0; f < R::FACES; ++f) faces[f] = cnt[f];
+        for (int c = 0; c < Kernel<R>::CAT_N; ++c) scores[c] = static_cast<uint8_t>(all[c]);
+        int i = R::DICE - 1;                //  ĵ 
+        while (i >= 0 && a[i] == R::FACES - 1) --i;
+        if (i < 0) break;
+        ++a[i];
+        for (int j = i + 1; j < R::DICE; ++j) a[j] = a[i];
+    }
+    return t;
+}
+
+template <class R>
+inline constexpr HandTable<R> HAND_TABLE = makeHandTable<R>();
+
+constexpr bool sameScores(const array<array<uint8_t, 13>, 252>& a, const array<array<uint8_t, 13>, 252>& b) {
+    for (int h = 0; h < 252; ++h) for (int c = 0; c < 13; ++c) if (a[h][c] != b[h][c]) return false;
+    return true;
+}
+// å Ŀ    Լ(dicetab::scoreCounts)       ð Ȯ
+static_assert(sameScores(HAND_TABLE<YahtzeeRules>.scores, dicetab::HAND_SCORES), " å Ŀΰ    ٸϴ");
+// īװ ϳ¥ score  ǥ    ( ո ĵ ֻ Ȯ)
+template <class R>
+constexpr bool scoreMatchesTable() {
+    for (int h = 0; h < R::HANDS; ++h) {
+        int dice[R::DICE] = {};
+        for (int f = 0, i = 0; f < R::FACES; ++f)
+            for (int k = 0; k < HAND_TABLE<R>.faces[h][f]; ++k) dice[i++] = f + 1;
+        for (int c = 0; c < Kernel<R>::CAT_N; ++c)
+            if (Kernel<R>::score(static_cast<Category>(c), dice) != HAND_TABLE<R>.scores[h][c]) return false;
+    }
+    return true;
+}
+static_assert(scoreMatchesTable<YahtzeeRules>() && scoreMatchesTable<YachtRules>(), "score  scoreCounts  ٸϴ");
+static_assert(Kernel<YahtzeeRules>::activeCount() == 13 && Kernel<YachtRules>::activeCount() == 12, "ĭ ");
+static_assert(HAND_TABLE<YachtRules>.scores[251][static_cast<int>(Category::YAHTZEE)] == 50, "Ʈ: 6 x 5");
+static_assert(HAND_TABLE<YachtRules>.scores[251][static_cast<int>(Category::FOUR_KIND)] == 24, "Ʈ: īε   4 ");
+
+} // namespace rules
+
+#endif // GAMERULES_H
\ No newline at end of file
@@ -0,0 +1,960 @@
+#include "gameServer.h"
+#include "gameTrace.h"
+
+#include <iostream>
+#include <deque>
+#include <unordered_map>
+#include <chrono>
+#include <iomanip>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// =================== ȭ ===================
+size_t encodeRoomState(const Room& room, int viewerSeat, char* out) {
+    out[0] = static_cast<char>(room.id & 0xFF);
+    out[1] = static_cast<char>((room.id >> 8) & 0xFF);
+    out[2] = static_cast<char>((room.id >> 16) & 0xFF);
+    out[3] = static_cast<char>((room.id >> 24) & 0xFF);
+    out[4] = static_cast<char>(room.round);
+    out[5] = static_cast<char>(room.current);
+    out[6] = static_cast<char>(3 - room.rolls);
+    uint8_t heldMask = 0;
+    for (int i = 0; i < 5; ++i) {
+        out[7 + i] = static_cast<char>(room.dice[i]);
+        if (room.held[i]) heldMask |= static_cast<uint8_t>(1 << i);
+    }
+    out[12] = static_cast<char>(heldMask);
+    out[13] = static_cast<char>(viewerSeat < 0 ? 0xFF : viewerSeat);
+    out[14] = static_cast<char>(room.lastRound());
+    out[15] = static_cast<char>(room.players.size());
+    size_t n = 16;
+    for (const auto& sc : room.players) {
+        uint16_t used = 0;
+        for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) if (sc.used[c]) used |= static_cast<uint16_t>(1 << c);
+        int16_t total = static_cast<int16_t>(sc.total());
+        out[n++] = static_cast<char>(used & 0xFF);
+        out[n++] = static_cast<char>(used >> 8);
+        out[n++] = static_cast<char>(total & 0xFF);
+        out[n++] = static_cast<char>((total >> 8) & 0xFF);
+    }
+    return n;
+}
+
+SharedFramePtr encodeSpectatorFrame(const Room& room, bool keyframe) {
+    char payload[MAX_FRAME];
+    memcpy(payload, &room.frameSeq, 4);
+    size_t n = 4 + encodeRoomState(room, -1, payload + 4);
+    for (const auto& sc : room.players) {
+        for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) payload[n++] = static_cast<char>(sc.used[c] ? sc.scores[c] : 0);
+        payload[n++] = static_cast<char>(sc.yahtzeeBonusCount);
+    }
+    if (keyframe) {
+        for (const auto& sc : room.players) {
+            size_t len = (std::min)(sc.name.size(), static_cast<size_t>(48));
+            payload[n++] = static_cast<char>(len);
+            memcpy(payload + n, sc.name.data(), len);
+            n += len;
+        }
+    }
+    auto frame = make_shared<SharedFrame>();
+    frame->seq = room.frameSeq;
+    frame->keyframe = keyframe;
+    frame->bytes.resize(FRAME_HEADER + n);
+    writeFrame(frame->bytes.data(), keyframe ? MsgType::KEYFRAME : MsgType::EVENT, payload, n);
+    return frame;
+}
+
+// ===================  / IO   ===================
+enum BucketState : uint8_t { BUCKET_FOREIGN, BUCKET_OWNED, BUCKET_FORWARDING, BUCKET_INCOMING };
+
+struct GameServer::Shard {
+    int idx = 0;
+    thread th;
+    unordered_map<uint32_t, unique_ptr<Room>> rooms;
+    array<uint8_t, ROOM_BUCKETS> state{};
+    array<uint16_t, ROOM_BUCKETS> forwardTo{};
+    array<uint32_t, ROOM_BUCKETS> fenceWait{};      //  FENCE    IO  Ʈ
+    unordered_map<int, vector<ShardMsg>> stash;     // key = bucket * 32 + io,  Ʈ   û
+    vector<uint32_t> autoplayRooms;
+    atomic<uint64_t> processed{ 0 };
+};
+
+struct GameServer::IoThread {
+    struct Conn {
+        socket_t sock = INVALID_SOCK;
+        uint32_t room = 0;
+        bool joined = false;
+        FrameReader reader;
+        string pending;
+
+        //  ۽ ť.   ۸ Ű⸸ Ѵ
+        bool spectator = false;
+        bool needKeyframe = true;
+        bool dirty = false;
+        deque<SharedFramePtr> queue;
+        size_t queuedBytes = 0;
+        size_t frontOffset = 0;
+    };
+    struct RoomViewers {
+        vector<int32_t> ids;
+        bool resyncPending = false;
+    };
+    int idx = 0;
+    thread th;
+    vector<uint16_t> route;
+    unordered_map<int32_t, Conn> conns;
+    int32_t nextSlot = 0;
+    SpscRing<socket_t, 1024> accepted;              //  = IO 0 (accept )
+    vector<deque<ShardMsg>> backlog;                //    á   ϸ 
+    unordered_map<uint32_t, RoomViewers> roomViewers;
+    vector<int32_t> dirtyViewers;
+};
+
+static const int CLIENT_IO_SHIFT = 20;
+
+GameServer::GameServer(const ServerConfig& config) : cfg(config) {
+    if (cfg.shards < 1) cfg.shards = 1;
+    if (cfg.ioThreads < 1) cfg.ioThreads = 1;
+    if (cfg.ioThreads > MAX_IO_THREADS) cfg.ioThreads = MAX_IO_THREADS;
+    for (int b = 0; b < ROOM_BUCKETS; ++b) {
+        owner[b].store(b % cfg.shards);
+        bucketLoad[b].store(0);
+    }
+}
+
+GameServer::~GameServer() { stop(); }
+
+bool GameServer::start() {
+    if (running.load()) return true;
+    if (!netStartup()) return false;
+    listener = listenTcp(cfg.port);
+    if (listener == INVALID_SOCK) {
+        cerr << "    ϴ (Ʈ " << cfg.port << ")." << endl;
+        return false;
+    }
+    setNonBlocking(listener);
+    boundPort = localPort(listener);
+
+    const int S = cfg.shards, I = cfg.ioThreads;
+    for (int i = 0; i < I * S; ++i) ioToShard.emplace_back(new ShardRing());
+    for (int i = 0; i < S * I; ++i) shardToIo.emplace_back(new IoRing());
+    for (int i = 0; i < S * S; ++i) shardToShard.emplace_back(new ShardRing());
+    for (int i = 0; i < S; ++i) control.emplace_back(new ShardRing());
+
+    for (int s = 0; s < S; ++s) {
+        auto sh = make_unique<Shard>();
+        sh->idx = s;
+        for (int b = 0; b < ROOM_BUCKETS; ++b) sh->state[b] = (b % S == s) ? BUCKET_OWNED : BUCKET_FOREIGN;
+        shards.push_back(move(sh));
+    }
+    for (int i = 0; i < I; ++i) {
+        auto io = make_unique<IoThread>();
+        io->idx = i;
+        io->route.resize(ROOM_BUCKETS);
+        for (int b = 0; b < ROOM_BUCKETS; ++b) io->route[b] = static_cast<uint16_t>(b % S);
+        io->backlog.resize(S);
+        ios.push_back(move(io));
+    }
+
+    running.store(true);
+    for (int s = 0; s < S; ++s) shards[s]->th = thread(&GameServer::shardLoop, this, s);
+    for (int i = 0; i < I; ++i) ios[i]->th = thread(&GameServer::ioLoop, this, i);
+    if (cfg.autoRebalance && S > 1) rebalancer = thread(&GameServer::rebalanceLoop, this);
+    return true;
+}
+
+void GameServer::stop() {
+    if (!running.exchange(false)) return;
+    if (rebalancer.joinable()) rebalancer.join();
+    for (auto& io : ios) if (io->th.joinable()) io->th.join();
+    for (auto& sh : shards) if (sh->th.joinable()) sh->th.join();
+    for (auto& io : ios) {
+        for (auto& kv : io->conns) closeSocket(kv.second.sock);
+        socket_t s;
+        while (io->accepted.pop(s)) closeSocket(s);
+    }
+    //      
+    ShardMsg m;
+    for (auto& r : shardToShard) while (r->pop(m)) if (m.kind == ShardMsgKind::ROOM_IN) delete m.moved;
+    if (listener != INVALID_SOCK) { closeSocket(listener); listener = INVALID_SOCK; }
+}
+
+uint64_t GameServer::shardMessages(int shard) const {
+    return shards[shard]->processed.load(memory_order_relaxed);
+}
+
+SpectatorStats GameServer::spectatorStats() const {
+    SpectatorStats st;
+    st.eventsBuilt = statEvents.load(memory_order_relaxed);
+    st.keyframesBuilt = statKeyframes.load(memory_order_relaxed);
+    st.framesQueued = statQueued.load(memory_order_relaxed);
+    st.framesDropped = statDropped.load(memory_order_relaxed);
+    st.resyncs = statResyncs.load(memory_order_relaxed);
+    st.sendCalls = statSendCalls.load(memory_order_relaxed);
+    return st;
+}
+
+// ===================  /  ===================
+bool GameServer::migrateBucket(int bucket, int targetShard) {
+    if (bucket < 0 || bucket >= ROOM_BUCKETS || targetShard < 0 || targetShard >= cfg.shards) return false;
+    int from = owner[bucket].load(memory_order_acquire);
+    if (from < 0 || from == targetShard) return false;
+    ShardMsg m;
+    m.kind = ShardMsgKind::MIGRATE;
+    m.room = static_cast<uint32_t>(bucket);
+    m.target = static_cast<uint16_t>(targetShard);
+    owner[bucket].store(-1, memory_order_release);
+    if (!control[from]->push(m)) { owner[bucket].store(from, memory_order_release); return false; }
+    return true;
+}
+
+bool GameServer::rebalanceOnce() {
+    const int S = cfg.shards;
+    vector<uint64_t> load(S, 0);
+    array<uint32_t, ROOM_BUCKETS> snapshot{};
+    for (int b = 0; b < ROOM_BUCKETS; ++b) {
+        snapshot[b] = bucketLoad[b].exchange(0, memory_order_relaxed);
+        int o = owner[b].load(memory_order_acquire);
+        if (o < 0) return false;    //  ְ  
+        load[o] += snapshot[b];
+    }
+    int hi = 0, lo = 0;
+    for (int s = 1; s < S; ++s) {
+        if (load[s] > load[hi]) hi = s;
+        if (load[s] < load[lo]) lo = s;
+    }
+    if (hi == lo || load[hi] < 100 || load[hi] - load[lo] < load[hi] / 5) return false;
+
+    //  ݿ   ϸ  Ŷ ű
+    uint64_t want = (load[hi] - load[lo]) / 2;
+    int best = -1; uint64_t bestDiff = UINT64_MAX;
+    for (int b = 0; b < ROOM_BUCKETS; ++b) {
+        if (owner[b].load() != hi || snapshot[b] == 0 || snapshot[b] >= load[hi]) continue;
+        uint64_t diff = snapshot[b] > want ? snapshot[b] - want : want - snapshot[b];
+        if (diff < bestDiff) { bestDiff = diff; best = b; }
+    }
+    return best >= 0 && migrateBucket(best, lo);
+}
+
+void GameServer::rebalanceLoop() {
+    while (running.load(memory_order_relaxed)) {
+        for (int i = 0; i < 10 && running.load(memory_order_relaxed); ++i) this_thread::sleep_for(chrono::milliseconds(50));
+        rebalanceOnce();
+    }
+}
+
+// ===================   ===================
+void GameServer::pushToIo(Shard& sh, const IoMsg& m) {
+    IoRing& r = outRing(sh.idx, m.kind == IoMsgKind::FRAME ? (m.client >> CLIENT_IO_SHIFT) : m.target);
+    while (!r.push(m)) {
+        if (!running.load(memory_order_relaxed)) return;
+        this_thread::yield();
+    }
+}
+
+void GameServer::pushToPeer(Shard& sh, int to, const ShardMsg& m) {
+    ShardRing& r = peerRing(sh.idx, to);
+    while (!r.push(m)) {
+        if (!running.load(memory_order_relaxed)) { if (m.kind == ShardMsgKind::ROOM_IN) delete m.moved; return; }
+        this_thread::yield();
+    }
+}
+
+void GameServer::shardLoop(int idx) {
+    traceThreadName("shard");
+    Shard& sh = *shards[idx];
+    const int S = cfg.shards, I = cfg.ioThreads;
+    int idle = 0;
+    ShardMsg m;
+    while (running.load(memory_order_relaxed)) {
+        bool busy = false;
+        while (control[idx]->pop(m)) { handleShardMsg(sh, m, true); busy = true; }
+        for (int from = 0; from < S; ++from) {
+            if (from == idx) continue;
+            for (int k = 0; k < 64 && peerRing(from, idx).pop(m); ++k) { handleShardMsg(sh, m, false); busy = true; }
+        }
+        for (int io = 0; io < I; ++io) {
+            for (int k = 0; k < 64 && inRing(io, idx).pop(m); ++k) { handleShardMsg(sh, m, true); busy = true; }
+        }
+        if (!sh.autoplayRooms.empty()) stepAutoplay(sh);
+        if (busy) { idle = 0; continue; }
+        if (++idle < 1000) this_thread::yield();
+        else this_thread::sleep_for(chrono::microseconds(100));
+    }
+}
+
+void GameServer::handleShardMsg(Shard& sh, const ShardMsg& m, bool direct) {
+    const int I = cfg.ioThreads;
+    const uint32_t allIo = (I >= 32) ? 0xFFFFFFFFu : ((1u << I) - 1);
+    switch (m.kind) {
+    case ShardMsgKind::MIGRATE: {
+        int b = static_cast<int>(m.room);
+        if (sh.state[b] != BUCKET_OWNED || m.target == sh.idx) { owner[b].store(sh.idx, memory_order_release); return; }
+        ShardMsg begin; begin.kind = ShardMsgKind::MIGRATE_BEGIN; begin.room = m.room;
+        pushToPeer(sh, m.target, begin);
+        for (auto it = sh.rooms.begin(); it != sh.rooms.end();) {
+            if (roomBucket(it->first) != b) { ++it; continue; }
+            ShardMsg mv; mv.kind = ShardMsgKind::ROOM_IN; mv.room = it->first; mv.moved = it->second.release();
+            pushToPeer(sh, m.target, mv);
+            it = sh.rooms.erase(it);
+        }
+        sh.state[b] = BUCKET_FORWARDING;
+        sh.forwardTo[b] = m.target;
+        sh.fenceWait[b] = allIo;
+        for (int io = 0; io < I; ++io) {
+            IoMsg u; u.kind = IoMsgKind::ROUTE_UPDATE;
+            u.bucket = static_cast<uint16_t>(b); u.target = static_cast<uint16_t>(io); u.from = static_cast<uint16_t>(sh.idx);
+            u.client = m.target;    // ROUTE_UPDATE    
+            pushToIo(sh, u);
+        }
+        return;
+    }
+    case ShardMsgKind::MIGRATE_BEGIN: {
+        int b = static_cast<int>(m.room);
+        sh.state[b] = BUCKET_INCOMING;
+        sh.fenceWait[b] = allIo;
+        return;
+    }
+    case ShardMsgKind::ROOM_IN:
+        if (m.moved->autoplay) sh.autoplayRooms.push_back(m.room);
+        sh.rooms[m.room].reset(m.moved);
+        return;
+    case ShardMsgKind::FENCE: {
+        int b = static_cast<int>(m.room);
+        uint32_t bit = 1u << m.io;
+        if (sh.state[b] == BUCKET_FORWARDING) {
+            pushToPeer(sh, sh.forwardTo[b], m);
+            sh.fenceWait[b] &= ~bit;
+            if (sh.fenceWait[b] == 0) sh.state[b] = BUCKET_FOREIGN;
+        }
+        else if (sh.state[b] == BUCKET_INCOMING) {
+            sh.fenceWait[b] &= ~bit;
+            auto it = sh.stash.find(b * 32 + m.io);
+            if (it != sh.stash.end()) {
+                vector<ShardMsg> pending = move(it->second);
+                sh.stash.erase(it);
+                for (const auto& p : pending) applyClientMsg(sh, p);
+            }
+            if (sh.fenceWait[b] == 0) {
+                sh.state[b] = BUCKET_OWNED;
+                owner[b].store(sh.idx, memory_order_release);
+                migrations.fetch_add(1, memory_order_relaxed);
+            }
+        }
+        return;
+    }
+    case ShardMsgKind::CLIENT:
+    case ShardMsgKind::CLIENT_GONE:
+    case ShardMsgKind::SPECTATE:
+    case ShardMsgKind::UNSPECTATE:
+    case ShardMsgKind::RESYNC: {
+        int b = roomBucket(m.room);
+        switch (sh.state[b]) {
+        case BUCKET_OWNED: applyClientMsg(sh, m); break;
+        case BUCKET_FORWARDING: pushToPeer(sh, sh.forwardTo[b], m); break;
+        case BUCKET_INCOMING:
+            if (!direct || !(sh.fenceWait[b] & (1u << m.io))) applyClientMsg(sh, m);
+            else sh.stash[b * 32 + m.io].push_back(m);
+            break;
+        default:
+            //  Ʈ  û MIGRATE_BEGIN    
+            if (direct) sh.stash[b * 32 + m.io].push_back(m);
+            else applyClientMsg(sh, m);
+            break;
+        }
+        return;
+    }
+    }
+}
+
+static void advanceTurn(Room& room) {
+    room.rolls = 0;
+    room.held.fill(false);
+    if (++room.current >= static_cast<int>(room.players.size())) {
+        room.current = 0;
+        if (++room.round > room.lastRound()) room.round = room.lastRound() + 1;
+    }
+}
+
+static void runAITurns(Room& room) {
+    while (!room.autoplay && room.playing() && room.seats[room.current] == SEAT_AI) {
+        playAITurn(room.players[room.current], room.dice, room.round, room.aiLevel[room.current], nullptr, &room.players);
+        advanceTurn(room);
+    }
+}
+
+static bool hasHumanSeat(const Room& room) {
+    for (int s : room.seats) if (s != SEAT_AI) return true;
+    return false;
+}
+
+static bool hasViewers(const Room& room) {
+    for (uint32_t v : room.viewers) if (v) return true;
+    return false;
+}
+
+static int64_t steadyMs() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//      AI  Ͼ,  ΰ  ڰ   ְ Ѵ
+void GameServer::stepAutoplay(Shard& sh) {
+    int64_t now = steadyMs();
+    for (size_t i = 0; i < sh.autoplayRooms.size();) {
+        auto it = sh.rooms.find(sh.autoplayRooms[i]);
+        bool keep = it != sh.rooms.end() && it->second->autoplay;
+        if (keep) {
+            Room& room = *it->second;
+            if (now >= room.nextAutoStepMs) {
+                playAITurn(room.players[room.current], room.dice, room.round, room.aiLevel[room.current], nullptr, &room.players);
+                advanceTurn(room);
+                if (!room.playing()) room.autoplay = false;
+                room.nextAutoStepMs = now + cfg.aiTurnIntervalMs;
+                broadcastState(sh, room);
+            }
+            keep = room.autoplay;
+        }
+        if (keep) ++i;
+        else { sh.autoplayRooms[i] = sh.autoplayRooms.back(); sh.autoplayRooms.pop_back(); }
+    }
+}
+
+void GameServer::applyClientMsg(Shard& sh, const ShardMsg& m) {
+    sh.processed.fetch_add(1, memory_order_relaxed);
+    bucketLoad[roomBucket(m.room)].fetch_add(1, memory_order_relaxed);
+
+    auto it = sh.rooms.find(m.room);
+    if (m.kind == ShardMsgKind::CLIENT_GONE) {
+        if (it == sh.rooms.end()) return;
+        Room& room = *it->second;
+        for (size_t i = 0; i < room.seats.size(); ++i) {
+            if (room.seats[i] == m.client) {
+                room.seats[i] = SEAT_AI;                //  ڸ  AI  ̾ 
+                room.aiLevel[i] = AIDifficulty::EASY;
+            }
+        }
+        if (!hasHumanSeat(room)) {
+            if (!hasViewers(room)) { sh.rooms.erase(it); return; }
+            // ڰ   AI   
+            if (room.playing() && !room.autoplay) {
+                room.autoplay = true;
+                room.nextAutoStepMs = steadyMs() + cfg.aiTurnIntervalMs;
+                sh.autoplayRooms.push_back(room.id);
+            }
+        }
+        runAITurns(room);
+        broadcastState(sh, room);
+        return;
+    }
+    if (m.kind == ShardMsgKind::UNSPECTATE || m.kind == ShardMsgKind::RESYNC) {
+        if (it == sh.rooms.end()) return;
+        Room& room = *it->second;
+        if (m.kind == ShardMsgKind::RESYNC) {
+            if (room.viewers[m.io]) sendKeyframe(sh, room, m.io);
+            return;
+        }
+        if (room.viewers[m.io]) room.viewers[m.io]--;
+        if (!hasViewers(room) && !hasHumanSeat(room)) sh.rooms.erase(it);
+        return;
+    }
+
+    if ((m.type == MsgType::JOIN || m.kind == ShardMsgKind::SPECTATE) && it == sh.rooms.end()) {
+        auto room = make_unique<Room>();
+        room->id = m.room;
+        it = sh.rooms.emplace(m.room, move(room)).first;
+    }
+    if (it == sh.rooms.end()) { sendError(sh, m.client, 1); return; }
+    Room& room = *it->second;
+    if (m.kind == ShardMsgKind::SPECTATE) {
+        room.viewers[m.io]++;
+        sendKeyframe(sh, room, m.io);
+        return;
+    }
+    const bool playing = room.playing();
+    const bool myTurn = playing && room.seats[room.current] == m.client;
+
+    switch (m.type) {
+    case MsgType::JOIN:
+    case MsgType::ADD_AI: {
+        if (playing) { sendError(sh, m.client, 2); return; }
+        if (room.players.size() >= MAX_ROOM_PLAYERS) { sendError(sh, m.client, 3); return; }
+        if (m.type == MsgType::JOIN) {
+            string name(m.name, strnlen(m.name, sizeof(m.name)));
+            if (name.empty()) name = u8"÷̾" + to_string(room.players.size() + 1);
+            room.players.emplace_back(name);
+            room.seats.push_back(m.client);
+            room.aiLevel.push_back(AIDifficulty::EASY);
+        }
+        else {
+            room.players.emplace_back(u8"ǻ" + to_string(room.players.size() + 1));
+            room.seats.push_back(SEAT_AI);
+            // MCTS  ܺ    带 Ƿ  · AI 
+            room.aiLevel.push_back(static_cast<AIDifficulty>(m.arg > 3 ? 3 : m.arg));
+        }
+        break;
+    }
+    case MsgType::START:
+        if (playing || room.players.empty()) { sendError(sh, m.client, 2); return; }
+        for (auto& sc : room.players) sc.clearScores();
+        room.round = 1; room.current = 0; room.rolls = 0; room.held.fill(false);
+        if (!hasHumanSeat(room)) {
+            room.autoplay = true;
+            room.nextAutoStepMs = steadyMs() + cfg.aiTurnIntervalMs;
+            sh.autoplayRooms.push_back(room.id);
+        }
+        runAITurns(room);
+        break;
+    case MsgType::ROLL:
+        if (!myTurn || room.rolls >= 3) { sendError(sh, m.client, 4); return; }
+        if (room.rolls == 0) room.held.fill(false);
+        for (int i = 0; i < 5; ++i) if (!room.held[i]) room.dice[i] = roll6();
+        room.rolls++;
+        break;
+    case MsgType::HOLD:
+        if (!myTurn || room.rolls == 0) { sendError(sh, m.client, 4); return; }
+        for (int i = 0; i < 5; ++i) room.held[i] = (m.arg >> i) & 1;
+        break;
+    case MsgType::SCORE:
+        if (!myTurn || room.rolls == 0 || m.arg >= static_cast<int>(Category::CATEGORY_COUNT) || room.players[room.current].used[m.arg]) {
+            sendError(sh, m.client, 5); return;
+        }
+        applyScore(room.players[room.current], static_cast<Category>(m.arg), room.dice);
+        advanceTurn(room);
+        runAITurns(room);
+        break;
+    default:
+        sendError(sh, m.client, 6);
+        return;
+    }
+    broadcastState(sh, room);
+}
+
+void GameServer::broadcastState(Shard& sh, Room& room) {
+    char payload[64];
+    for (size_t i = 0; i < room.seats.size(); ++i) {
+        if (room.seats[i] == SEAT_AI) continue;
+        IoMsg out;
+        out.client = room.seats[i];
+        size_t n = encodeRoomState(room, static_cast<int>(i), payload);
+        out.len = static_cast<uint16_t>(writeFrame(out.data, MsgType::STATE, payload, n));
+        pushToIo(sh, out);
+    }
+
+    // :  ϳ   ȭϰ, ڰ ִ IO 帶  ۸ ѱ
+    room.frameSeq++;
+    room.keyframe.reset();
+    if (!hasViewers(room)) return;
+    SharedFramePtr ev = encodeSpectatorFrame(room, false);
+    statEvents.fetch_add(1, memory_order_relaxed);
+    for (int io = 0; io < cfg.ioThreads; ++io) {
+        if (!room.viewers[io]) continue;
+        IoMsg out;
+        out.kind = IoMsgKind::SPECTATOR_FRAME;
+        out.target = static_cast<uint16_t>(io);
+        out.room = room.id;
+        out.frame = ev;
+        pushToIo(sh, out);
+    }
+}
+
+void GameServer::sendKeyframe(Shard& sh, Room& room, int io) {
+    if (!room.keyframe) {
+        room.keyframe = encodeSpectatorFrame(room, true);
+        statKeyframes.fetch_add(1, memory_order_relaxed);
+    }
+    IoMsg out;
+    out.kind = IoMsgKind::SPECTATOR_FRAME;
+    out.target = static_cast<uint16_t>(io);
+    out.room = room.id;
+    out.frame = room.keyframe;
+    pushToIo(sh, out);
+}
+
+void GameServer::sendError(Shard& sh, int32_t client, uint8_t code) {
+    IoMsg out;
+    out.client = client;
+    out.len = static_cast<uint16_t>(writeFrame(out.data, MsgType::ERR, &code, 1));
+    pushToIo(sh, out);
+}
+
+// =================== IO  ===================
+void GameServer::ioLoop(int idx) {
+    traceThreadName("io");
+    IoThread& io = *ios[idx];
+    const int S = cfg.shards, I = cfg.ioThreads;
+    vector<pollfd> fds;
+    vector<int32_t> ids;
+    char buf[16384];
+    int nextIo = 0;
+
+    auto flushBacklog = [&]() {
+        for (int s = 0; s < S; ++s) {
+            auto& q = io.backlog[s];
+            while (!q.empty() && inRing(idx, s).push(q.front())) q.pop_front();
+        }
+    };
+    auto toShard = [&](int s, const ShardMsg& m) {
+        if (!io.backlog[s].empty() || !inRing(idx, s).push(m)) io.backlog[s].push_back(m);
+    };
+    auto closeConn = [&](int32_t id) {
+        auto it = io.conns.find(id);
+        if (it == io.conns.end()) return;
+        IoThread::Conn& c = it->second;
+        if (c.joined) {
+            ShardMsg m; m.kind = c.spectator ? ShardMsgKind::UNSPECTATE : ShardMsgKind::CLIENT_GONE;
+            m.client = id; m.room = c.room; m.io = static_cast<uint8_t>(idx);
+            toShard(io.route[roomBucket(m.room)], m);
+        }
+        if (c.spectator) {
+            auto rv = io.roomViewers.find(c.room);
+            if (rv != io.roomViewers.end()) {
+                auto& v = rv->second.ids;
+                auto pos = find(v.begin(), v.end(), id);
+                if (pos != v.end()) { *pos = v.back(); v.pop_back(); }
+                if (v.empty()) io.roomViewers.erase(rv);
+            }
+        }
+        closeSocket(c.sock);
+        io.conns.erase(it);
+    };
+    //  ̰ų  ʴ Ŭ̾Ʈ  Ʈ ѵ   ´
+    auto writeConn = [&](int32_t id, IoThread::Conn& c, const char* data, size_t len) {
+        if (c.pending.empty()) {
+            long n = sendSome(c.sock, data, len);
+            if (n < 0) { closeConn(id); return; }
+            data += n; len -= static_cast<size_t>(n);
+        }
+        if (!len) return;
+        if (c.pending.size() + len > cfg.playerQueueBytes) { closeConn(id); return; }
+        c.pending.append(data, len);
+    };
+    //  ť ӵ   gather  
+    auto flushViewer = [&](int32_t id) {
+        auto it = io.conns.find(id);
+        if (it == io.conns.end()) return;
+        IoThread::Conn& c = it->second;
+        c.dirty = false;
+        if (c.queue.empty()) return;
+        IoSlice slices[MAX_IO_SLICES];
+        size_t count = 0;
+        for (const auto& f : c.queue) {
+            if (count == MAX_IO_SLICES) break;
+            size_t off = count == 0 ? c.frontOffset : 0;
+            slices[count++] = { f->bytes.data() + off, f->bytes.size() - off };
+        }
+        long n = sendSlices(c.sock, slices, count);
+        statSendCalls.fetch_add(1, memory_order_relaxed);
+        if (n < 0) { closeConn(id); return; }
+        size_t left = static_cast<size_t>(n);
+        while (left > 0) {
+            size_t remain = c.queue.front()->bytes.size() - c.frontOffset;
+            if (left < remain) { c.frontOffset += left; break; }
+            left -= remain;
+            c.queuedBytes -= c.queue.front()->bytes.size();
+            c.queue.pop_front();
+            c.frontOffset = 0;
+        }
+    };
+    auto fanOut = [&](const IoMsg& om) {
+        auto rv = io.roomViewers.find(om.room);
+        if (rv == io.roomViewers.end()) return;
+        const SharedFramePtr& f = om.frame;
+        if (f->keyframe) rv->second.resyncPending = false;
+        uint64_t queued = 0, dropped = 0;
+        for (int32_t id : rv->second.ids) {
+            auto it = io.conns.find(id);
+            if (it == io.conns.end()) continue;
+            IoThread::Conn& c = it->second;
+            if (f->keyframe) {
+                if (!c.needKeyframe) continue;
+                c.needKeyframe = false;
+            }
+            else if (c.needKeyframe) { dropped++; continue; }
+            else if (c.queuedBytes + f->bytes.size() > cfg.viewerQueueBytes) {
+                //  :  Ӹ    ŰӺ ٽ ޴´
+                size_t keep = c.frontOffset > 0 ? 1 : 0;
+                dropped += c.queue.size() - keep + 1;
+                while (c.queue.size() > keep) { c.queuedBytes -= c.queue.back()->bytes.size(); c.queue.pop_back(); }
+                c.needKeyframe = true;
+                if (!rv->second.resyncPending) {
+                    rv->second.resyncPending = true;
+                    ShardMsg m; m.kind = ShardMsgKind::RESYNC; m.client = id; m.room = om.room; m.io = static_cast<uint8_t>(idx);
+                    toShard(io.route[roomBucket(om.room)], m);
+                    statResyncs.fetch_add(1, memory_order_relaxed);
+                }
+                continue;
+            }
+            c.queue.push_back(f);
+            c.queuedBytes += f->bytes.size();
+            queued++;
+            if (!c.dirty) { c.dirty = true; io.dirtyViewers.push_back(id); }
+        }
+        statQueued.fetch_add(queued, memory_order_relaxed);
+        if (dropped) statDropped.fetch_add(dropped, memory_order_relaxed);
+    };
+    auto addConn = [&](socket_t s) {
+        setNonBlocking(s);
+        int32_t id = (idx << CLIENT_IO_SHIFT) | (io.nextSlot++ & ((1 << CLIENT_IO_SHIFT) - 1));
+        io.conns[id].sock = s;
+    };
+
+    while (running.load(memory_order_relaxed)) {
+        bool busy = false;
+        flushBacklog();
+
+        socket_t ns;
+        while (io.accepted.pop(ns)) { addConn(ns); busy = true; }
+
+        //  -> IO
+        IoMsg om;
+        for (int s = 0; s < S; ++s) {
+            for (int k = 0; k < 256 && outRing(s, idx).pop(om); ++k) {
+                busy = true;
+                if (om.kind == IoMsgKind::ROUTE_UPDATE) {
+                    io.route[om.bucket] = static_cast<uint16_t>(om.client);
+                    ShardMsg f; f.kind = ShardMsgKind::FENCE; f.room = om.bucket; f.io = static_cast<uint8_t>(idx);
+                    toShard(om.from, f);
+                    continue;
+                }
+                if (om.kind == IoMsgKind::SPECTATOR_FRAME) { fanOut(om); continue; }
+                auto it = io.conns.find(om.client);
+                if (it != io.conns.end()) writeConn(it->first, it->second, om.data, om.len);
+            }
+        }
+        for (int32_t id : io.dirtyViewers) flushViewer(id);
+        io.dirtyViewers.clear();
+
+        fds.clear(); ids.clear();
+        if (idx == 0) { fds.push_back(pollfd{ listener, POLLIN, 0 }); ids.push_back(-1); }
+        for (auto& kv : io.conns) {
+            short ev = POLLIN;
+            if (!kv.second.pending.empty() || !kv.second.queue.empty()) ev |= POLLOUT;
+            fds.push_back(pollfd{ kv.second.sock, ev, 0 });
+            ids.push_back(kv.first);
+        }
+        if (fds.empty()) { this_thread::sleep_for(chrono::milliseconds(1)); continue; }
+        int ready = pollSockets(fds, busy ? 0 : 1);
+        if (ready <= 0) continue;
+
+        for (size_t i = 0; i < fds.size(); ++i) {
+            if (!fds[i].revents) continue;
+            if (ids[i] == -1) {
+                socket_t c;
+                while ((c = acceptTcp(listener)) != INVALID_SOCK) {
+                    int target = nextIo++ % I;
+                    if (target == idx || !ios[target]->accepted.push(c)) addConn(c);
+                }
+                continue;
+            }
+            auto it = io.conns.find(ids[i]);
+            if (it == io.conns.end()) continue;
+            IoThread::Conn& c = it->second;
+            if ((fds[i].revents & POLLOUT) && c.spectator) {
+                flushViewer(ids[i]);
+                if (io.conns.find(ids[i]) == io.conns.end()) continue;
+            }
+            else if (fds[i].revents & POLLOUT) {
+                long n = sendSome(c.sock, c.pending.data(), c.pending.size());
+                if (n < 0) { closeConn(ids[i]); continue; }
+                c.pending.erase(0, static_cast<size_t>(n));
+            }
+            if (!(fds[i].revents & (POLLIN | POLLERR | POLLHUP))) continue;
+            long n = recvSome(c.sock, buf, sizeof(buf));
+            if (n < 0) { closeConn(ids[i]); continue; }
+            c.reader.append(buf, static_cast<size_t>(n));
+            if (c.reader.overflowed()) { closeConn(ids[i]); continue; }
+
+            MsgType type; const char* payload; size_t len;
+            while (c.reader.next(type, payload, len)) {
+                ShardMsg m;
+                m.client = ids[i];
+                m.io = static_cast<uint8_t>(idx);
+                m.type = type;
+                if (type == MsgType::JOIN || type == MsgType::SPECTATE) {
+                    if (c.joined || len < 4) continue;
+                    c.room = static_cast<uint8_t>(payload[0]) | (static_cast<uint8_t>(payload[1]) << 8) |
+                        (static_cast<uint8_t>(payload[2]) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(payload[3])) << 24);
+                    c.joined = true;
+                    if (type == MsgType::SPECTATE) {
+                        c.spectator = true;
+                        setsockopt(c.sock, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&cfg.viewerSendBuffer), sizeof(cfg.viewerSendBuffer));
+                        io.roomViewers[c.room].ids.push_back(ids[i]);
+                        m.kind = ShardMsgKind::SPECTATE;
+                    }
+                    else memcpy(m.name, payload + 4, (std::min)(len - 4, sizeof(m.name) - 1));
+                }
+                else if (!c.joined) continue;
+                else if (len > 0) m.arg = static_cast<uint8_t>(payload[0]);
+                m.room = c.room;
+                toShard(io.route[roomBucket(c.room)], m);
+            }
+        }
+    }
+}
+
+// ===================  / ġũ ===================
+int runServer(const ServerConfig& cfg) {
+    GameServer server(cfg);
+    if (!server.start()) return 1;
+    cout << u8" : Ʈ " << server.port() << u8",  " << cfg.shards << u8", IO  " << cfg.ioThreads << endl;
+    cout << u8"Enter   մϴ." << endl;
+    string line; getline(cin, line);
+    server.stop();
+    return 0;
+}
+
+// û ϳ STATE/ERR  ϳ ƿ ܼ .     
+static void benchClient(uint16_t port, uint32_t firstRoom, int conns, atomic<bool>& stopFlag, atomic<uint64_t>& actions, atomic<uint64_t>& games) {
+    struct BotConn { socket_t s; MsgType next; uint8_t arg; };
+    vector<BotConn> bots;
+    for (int i = 0; i < conns; ++i) {
+        socket_t s = connectTcp("127.0.0.1", port);
+        if (s == INVALID_SOCK) continue;
+        char join[8];
+        uint32_t room = firstRoom + static_cast<uint32_t>(i);
+        memcpy(join, &room, 4); memcpy(join + 4, "bot", 3);
+        MsgType t; vector<char> p;
+        uint8_t aiLevel = static_cast<uint8_t>(AIDifficulty::NORMAL);
+        if (!sendFrameBlocking(s, MsgType::JOIN, join, 7) || !recvFrameBlocking(s, t, p) ||
+            !sendFrameBlocking(s, MsgType::ADD_AI, &aiLevel, 1) || !recvFrameBlocking(s, t, p)) {
+            closeSocket(s); continue;
+        }
+        bots.push_back({ s, MsgType::START, 0 });
+    }
+    uint64_t done = 0, finished = 0;
+    MsgType t; vector<char> p;
+    while (!stopFlag.load(memory_order_relaxed) && !bots.empty()) {
+        for (auto& b : bots) sendFrameBlocking(b.s, b.next, &b.arg, b.next == MsgType::SCORE ? 1 : 0);
+        for (auto& b : bots) {
+            if (!recvFrameBlocking(b.s, t, p) || t != MsgType::STATE || p.size() < 20) { b.next = MsgType::START; continue; }
+            done++;
+            int round = static_cast<uint8_t>(p[4]), rollsLeft = static_cast<uint8_t>(p[6]);
+            const int lastRound = static_cast<uint8_t>(p[14]);
+            uint16_t used = static_cast<uint8_t>(p[16]) | (static_cast<uint8_t>(p[17]) << 8);
+            if (round < 1 || round > lastRound) { if (round > lastRound) finished++; b.next = MsgType::START; continue; }
+            if (rollsLeft == 3) { b.next = MsgType::ROLL; continue; }
+            int cat = 0;
+            while (cat < static_cast<int>(Category::CATEGORY_COUNT) && (used >> cat) & 1) cat++;
+            b.next = MsgType::SCORE; b.arg = static_cast<uint8_t>(cat);
+        }
+    }
+    for (auto& b : bots) closeSocket(b.s);
+    actions.fetch_add(done);
+    games.fetch_add(finished);
+}
+
+void runServerBenchmark(int maxShards, int connections, int seconds) {
+    if (maxShards < 1) maxShards = 1;
+    if (connections < 1) connections = 1;
+    netStartup();
+    cout << "shards  io  actions/s  games/s  scale  migrations" << endl;
+    double base = 0;
+    for (int s = 1; s <= maxShards; ++s) {
+        ServerConfig cfg;
+        cfg.port = 0; cfg.shards = s; cfg.ioThreads = (std::max)(1, s / 4); cfg.autoRebalance = true;
+        GameServer server(cfg);
+        if (!server.start()) return;
+
+        int clientThreads = (std::max)(1, (std::min)(connections, (int)thread::hardware_concurrency() / 2));
+        atomic<bool> stopFlag{ false };
+        atomic<uint64_t> actions{ 0 }, games{ 0 };
+        vector<thread> clients;
+        int perThread = connections / clientThreads;
+        for (int c = 0; c < clientThreads; ++c) {
+            int n = perThread + (c < connections % clientThreads ? 1 : 0);
+            clients.emplace_back(benchClient, server.port(), static_cast<uint32_t>(c * 100000 + 1), n, ref(stopFlag), ref(actions), ref(games));
+        }
+        this_thread::sleep_for(chrono::seconds(seconds));
+        stopFlag.store(true);
+        for (auto& t : clients) t.join();
+        server.stop();
+
+        double aps = static_cast<double>(actions.load()) / seconds;
+        if (s == 1) base = aps;
+        cout << setw(6) << s << setw(4) << cfg.ioThreads << setw(11) << static_cast<long long>(aps)
+            << setw(9) << fixed << setprecision(1) << static_cast<double>(games.load()) / seconds
+            << setw(7) << setprecision(2) << (base > 0 ? aps / base : 0.0) << setw(12) << server.migrationsDone() << endl;
+    }
+}
+
+void runSpectatorBenchmark(int viewers, int slowPercent, int seconds) {
+    netStartup();
+#ifndef _WIN32
+    rlimit lim;
+    if (getrlimit(RLIMIT_NOFILE, &lim) == 0) { lim.rlim_cur = lim.rlim_max; setrlimit(RLIMIT_NOFILE, &lim); }
+#endif
+    ServerConfig cfg;
+    cfg.port = 0; cfg.shards = 1; cfg.ioThreads = 2; cfg.autoRebalance = false; cfg.aiTurnIntervalMs = 2;
+    GameServer server(cfg);
+    if (!server.start()) return;
+
+    const uint32_t room = 1;
+    socket_t host = connectTcp("127.0.0.1", server.port());
+    if (host == INVALID_SOCK) return;
+    MsgType t; vector<char> p;
+    uint8_t lvl = static_cast<uint8_t>(AIDifficulty::EASY);
+    sendFrameBlocking(host, MsgType::SPECTATE, &room, 4);
+    recvFrameBlocking(host, t, p);
+    for (int i = 0; i < 4; ++i) sendFrameBlocking(host, MsgType::ADD_AI, &lvl, 1);
+
+    vector<socket_t> fast, slow;
+    for (int i = 0; i < viewers; ++i) {
+        socket_t s = connectTcp("127.0.0.1", server.port());
+        if (s == INVALID_SOCK) { cerr << i << u8"°    ( ũ ѵ?)" << endl; break; }
+        bool isSlow = (i * 100 / (std::max)(1, viewers)) < slowPercent;
+        if (isSlow) {
+            int small = 4096;
+            setsockopt(s, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&small), sizeof(small));
+        }
+        sendFrameBlocking(s, MsgType::SPECTATE, &room, 4);
+        setNonBlocking(s);
+        (isSlow ? slow : fast).push_back(s);
+    }
+    sendFrameBlocking(host, MsgType::START, nullptr, 0);
+    setNonBlocking(host);
+
+    //  ڴ  а,  ڴ  ʴ´.   host  ٽ 
+    uint64_t received = 0, keyframes = 0, restarts = 0;
+    vector<FrameReader> readers(fast.size() + 1);
+    vector<pollfd> fds;
+    for (socket_t s : fast) fds.push_back(pollfd{ s, POLLIN, 0 });
+    fds.push_back(pollfd{ host, POLLIN, 0 });
+    char buf[65536];
+    auto begin = chrono::steady_clock::now();
+    auto deadline = begin + chrono::seconds(seconds);
+    while (chrono::steady_clock::now() < deadline) {
+        if (pollSockets(fds, 10) <= 0) continue;
+        for (size_t i = 0; i < fds.size(); ++i) {
+            if (!(fds[i].revents & POLLIN)) continue;
+            long n = recvSome(fds[i].fd, buf, sizeof(buf));
+            if (n <= 0) continue;
+            readers[i].append(buf, static_cast<size_t>(n));
+            MsgType type; const char* payload; size_t len;
+            while (readers[i].next(type, payload, len)) {
+                bool isHost = i + 1 == fds.size();
+                if (!isHost) { received++; if (type == MsgType::KEYFRAME) keyframes++; }
+                if (isHost && len > 18 && static_cast<uint8_t>(payload[8]) > static_cast<uint8_t>(payload[18])) {
+                    sendFrameBlocking(host, MsgType::START, nullptr, 0);
+                    restarts++;
+                }
+            }
+        }
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+    SpectatorStats st = server.spectatorStats();
+    server.stop();
+    for (socket_t s : fast) closeSocket(s);
+    for (socket_t s : slow) closeSocket(s);
+    closeSocket(host);
+
+    cout << u8" " << fast.size() + slow.size() << u8" (  " << slow.size() << u8"), " << fixed << setprecision(1) << elapsed << u8",  " << restarts << u8"ȸ" << endl;
+    cout << u8"ȭ ̺Ʈ " << st.eventsBuilt << u8", Ű " << st.keyframesBuilt << u8" ( ȭ 1ȸ)" << endl;
+    cout << u8"ť   " << st.framesQueued << " (" << setprecision(0) << st.framesQueued / elapsed << u8"/s, ̺Ʈ "
+        << setprecision(1) << (st.eventsBuilt ? static_cast<double>(st.framesQueued) / st.eventsBuilt : 0.0) << u8")" << endl;
+    cout << u8" ȣ " << st.sendCalls << u8" (ȣ  " << setprecision(2) << (st.sendCalls ? static_cast<double>(st.framesQueued) / st.sendCalls : 0.0) << ")" << endl;
+    cout << u8"   " << received << " (" << setprecision(0) << received / elapsed << u8"/s), Ű " << keyframes << endl;
+    cout << u8" ڿԼ   " << st.framesDropped << u8", 絿ȭ û " << st.resyncs << endl;
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+#pragma once
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <array>
+#include <memory>
+#include <string>
+#include <cstdint>
+
+#include "gameLogic.h"
+#include "gameAI.h"
+#include "gameNet.h"
+
+using namespace std;
+
+// ===================  / Һ   ===================
+//   ϳ Һ  ϳ ̿ Ѵ ( )
+template <typename T, size_t CAPACITY>
+class SpscRing {
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY  2 ŵ̾ մϴ");
+public:
+    bool push(const T& v) {
+        size_t t = tail.load(memory_order_relaxed);
+        if (t - cachedHead == CAPACITY) {
+            cachedHead = head.load(memory_order_acquire);
+            if (t - cachedHead == CAPACITY) return false;
+        }
+        slots[t & (CAPACITY - 1)] = v;
+        tail.store(t + 1, memory_order_release);
+        return true;
+    }
+    bool pop(T& out) {
+        size_t h = head.load(memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(memory_order_acquire);
+            if (h == cachedTail) return false;
+        }
+        out = move(slots[h & (CAPACITY - 1)]);
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+    bool empty() const { return head.load(memory_order_acquire) == tail.load(memory_order_acquire); }
+
+private:
+    alignas(64) atomic<size_t> head{ 0 };   // Һ 
+    size_t cachedTail = 0;
+    alignas(64) atomic<size_t> tail{ 0 };   //  
+    size_t cachedHead = 0;
+    alignas(64) array<T, CAPACITY> slots{};
+};
+
+// ===================  ===================
+constexpr int MAX_ROOM_PLAYERS = 5;
+constexpr int ROOM_BUCKETS = 256;           //  id -> Ŷ -> . ִ Ŷ 
+constexpr int SEAT_AI = -1;
+constexpr int MAX_IO_THREADS = 32;
+
+// ڿ  ȭ .     ʰ    Ѵ
+struct SharedFrame {
+    vector<char> bytes;     //   , ״  
+    uint32_t seq = 0;
+    bool keyframe = false;
+};
+using SharedFramePtr = shared_ptr<const SharedFrame>;
+
+struct Room {
+    uint32_t id = 0;
+    vector<Scorecard> players;
+    vector<int> seats;                      // players[i]  ϴ Ŭ̾Ʈ id (SEAT_AI = ǻ)
+    vector<AIDifficulty> aiLevel;
+    Dice dice{ 1, 1, 1, 1, 1 };
+    array<bool, 5> held{};
+    int round = 0;                          // 0 =  , lastRound() + 1 =  
+    int current = 0;
+    int rolls = 0;
+    RulesVariant rules = rulesVariant();    //    Ģ.   = Ģ  ĭ 
+
+    int lastRound() const { return activeCategoryCount(rules); }
+    bool playing() const { return round >= 1 && round <= lastRound(); }
+
+    // 
+    uint32_t frameSeq = 0;
+    array<uint32_t, MAX_IO_THREADS> viewers{};  // IO 庰  
+    SharedFramePtr keyframe;                    //     Ű ( ʿ  )
+    bool autoplay = false;                      //   AI   (  )
+    int64_t nextAutoStepMs = 0;
+};
+
+inline int roomBucket(uint32_t roomId) { return static_cast<int>(roomId % ROOM_BUCKETS); }
+
+//  ¸ STATE  ̷ε ȭϰ ̸ ȯ.
+// [u32 room][u8 ][u8 ][u8  ][u8 ֻ x5][u8 Ȧ][u8  ڸ][u8  ][u8 ο][÷̾ u16  ĭ + i16 ]
+size_t encodeRoomState(const Room& room, int viewerSeat, char* out);
+//  : [u32 seq][encodeRoomState][÷̾ 13ĭ  + Ʈ ʽ ][Ű̸ ÷̾ u8  + ̸]
+SharedFramePtr encodeSpectatorFrame(const Room& room, bool keyframe);
+
+// ===================   ޽ ===================
+enum class ShardMsgKind : uint8_t {
+    CLIENT,         // Ŭ̾Ʈ û (IO -> , Ǵ    ->  )
+    CLIENT_GONE,    //  
+    MIGRATE,        // Ŷ target   ( -> )
+    MIGRATE_BEGIN,  //   ˸ ( -> )
+    ROOM_IN,        // ֵǴ  ( -> )
+    FENCE,          // IO 尡 Ʈ  (IO ->   ->  )
+    SPECTATE,       //   (IO -> )
+    UNSPECTATE,     //  
+    RESYNC,         // и ڰ  Ű  ޶ (IO -> )
+};
+
+struct ShardMsg {
+    ShardMsgKind kind = ShardMsgKind::CLIENT;
+    MsgType type = MsgType::ROLL;
+    uint8_t arg = 0;
+    uint8_t io = 0;
+    uint16_t target = 0;
+    int32_t client = 0;
+    uint32_t room = 0;
+    char name[16] = {};
+    Room* moved = nullptr;
+};
+
+enum class IoMsgKind : uint8_t { FRAME, ROUTE_UPDATE, SPECTATOR_FRAME };
+
+struct IoMsg {
+    IoMsgKind kind = IoMsgKind::FRAME;
+    uint16_t len = 0;
+    uint16_t bucket = 0;
+    uint16_t target = 0;
+    uint16_t from = 0;
+    int32_t client = 0;
+    uint32_t room = 0;
+    SharedFramePtr frame;       // SPECTATOR_FRAME: ش IO   ü  
+    char data[96] = {};
+};
+
+// ===================  ===================
+struct ServerConfig {
+    uint16_t port = 7777;       // 0 =  Ʈ
+    int shards = 2;
+    int ioThreads = 1;
+    bool autoRebalance = true;
+    int aiTurnIntervalMs = 700;         //   濡 AI    
+    size_t viewerQueueBytes = 16384;    //  ۽  ѵ.  и   Ű 絿ȭ
+    int viewerSendBuffer = 16384;       //   Ŀ ۽  ( ŭ Ƿ ۰)
+    size_t playerQueueBytes = 65536;    // ÷̾ ۽  ѵ.   ʴ Ŭ̾Ʈ   ´
+};
+
+struct SpectatorStats {
+    uint64_t eventsBuilt = 0;       // 尡 ȭ ̺Ʈ  
+    uint64_t keyframesBuilt = 0;
+    uint64_t framesQueued = 0;      //  ť    (  )
+    uint64_t framesDropped = 0;     //  ڿԼ   
+    uint64_t resyncs = 0;
+    uint64_t sendCalls = 0;         // sendSlices ȣ 
+};
+
+class GameServer {
+public:
+    static constexpr size_t RING_CAP = 1024;
+    using ShardRing = SpscRing<ShardMsg, RING_CAP>;
+    using IoRing = SpscRing<IoMsg, RING_CAP>;
+
+    explicit GameServer(const ServerConfig& cfg);
+    ~GameServer();
+
+    bool start();
+    void stop();
+    uint16_t port() const { return boundPort; }
+
+    //  (start  ȣ  Ǵ  ) ϳ ȣ
+    bool migrateBucket(int bucket, int targetShard);
+    bool rebalanceOnce();
+
+    int bucketOwner(int bucket) const { return owner[bucket].load(memory_order_acquire); }
+    uint64_t shardMessages(int shard) const;
+    uint64_t migrationsDone() const { return migrations.load(memory_order_relaxed); }
+    SpectatorStats spectatorStats() const;
+
+private:
+    struct Shard;
+    struct IoThread;
+
+    ServerConfig cfg;
+    socket_t listener = INVALID_SOCK;
+    uint16_t boundPort = 0;
+    atomic<bool> running{ false };
+
+    vector<unique_ptr<Shard>> shards;
+    vector<unique_ptr<IoThread>> ios;
+    vector<unique_ptr<ShardRing>> ioToShard;        // [io * S + shard]
+    vector<unique_ptr<IoRing>> shardToIo;           // [shard * I + io]
+    vector<unique_ptr<ShardRing>> shardToShard;     // [from * S + to]
+    vector<unique_ptr<ShardRing>> control;          // [shard],  =  
+    array<atomic<int>, ROOM_BUCKETS> owner;         //    (-1 =  )
+    array<atomic<uint32_t>, ROOM_BUCKETS> bucketLoad;
+    atomic<uint64_t> migrations{ 0 };
+    atomic<uint64_t> statEvents{ 0 }, statKeyframes{ 0 }, statQueued{ 0 }, statDropped{ 0 }, statResyncs{ 0 }, statSendCalls{ 0 };
+    thread rebalancer;
+
+    ShardRing& inRing(int io, int shard) { return *ioToShard[io * cfg.shards + shard]; }
+    IoRing& outRing(int shard, int io) { return *shardToIo[shard * cfg.ioThreads + io]; }
+    ShardRing& peerRing(int from, int to) { return *shardToShard[from * cfg.shards + to]; }
+
+    void shardLoop(int idx);
+    void ioLoop(int idx);
+    void rebalanceLoop();
+
+    //   ó
+    void handleShardMsg(Shard& sh, const ShardMsg& m, bool direct);
+    void applyClientMsg(Shard& sh, const ShardMsg& m);
+    void broadcastState(Shard& sh, Room& room);
+    void sendKeyframe(Shard& sh, Room& room, int io);
+    void stepAutoplay(Shard& sh);
+    void sendError(Shard& sh, int32_t client, uint8_t code);
+    void pushToIo(Shard& sh, const IoMsg& m);
+    void pushToPeer(Shard& sh, int to, const ShardMsg& m);
+};
+
+//  ( --server). Enter Է  
+int runServer(const ServerConfig& cfg);
+//  Ŭ̾Ʈ   1..maxShards  ó ( --bench-server)
+void runServerBenchmark(int maxShards, int connections, int seconds);
+// AI   ϳ  viewers  ٿ Ҿƿ  ( --bench-spectate). slowPercent%   ʴ 
+void runSpectatorBenchmark(int viewers, int slowPercent, int seconds);
+
+#endif // GAMESERVER_H
\ No newline at end of file
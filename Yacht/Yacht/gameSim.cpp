@@ -0,0 +1,296 @@
+#include "gameSim.h"
+#include "gameTrace.h"
+#include "gameRules.h"
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+// ¼ հ. Ŀ ڱ Ϳ ״ٰ   հ迡 Ѵ
+struct SimTally {
+    static constexpr int CATS = static_cast<int>(Category::CATEGORY_COUNT);
+    size_t seats = 0;
+    uint64_t games = 0, turns = 0;
+    vector<long long> scoreSum;
+    vector<double> winSum;
+    vector<double> beatSum;         // [a * seats + b]
+    vector<uint64_t> filled;        // [¼ * CATS + ĭ]
+
+    explicit SimTally(size_t n) : seats(n), scoreSum(n, 0), winSum(n, 0.0), beatSum(n * n, 0.0), filled(n * CATS, 0) {}
+
+    void addGame(const vector<Scorecard>& players, int rounds) {
+        int best = 0, winners = 0;
+        for (size_t p = 0; p < seats; ++p) best = (std::max)(best, players[p].total());
+        for (size_t p = 0; p < seats; ++p) winners += players[p].total() == best;
+        for (size_t a = 0; a < seats; ++a) {
+            const int ta = players[a].total();
+            scoreSum[a] += ta;
+            if (ta == best) winSum[a] += 1.0 / winners;
+            for (size_t b = 0; b < seats; ++b) {
+                if (a == b) continue;
+                const int tb = players[b].total();
+                beatSum[a * seats + b] += ta > tb ? 1.0 : ta == tb ? 0.5 : 0.0;
+            }
+            for (int c = 0; c < CATS; ++c) filled[a * CATS + c] += players[a].scores[c] > 0;
+        }
+        games++;
+        turns += static_cast<uint64_t>(rounds) * seats;
+    }
+    void mergeInto(SimTally& dst) const {
+        dst.games += games;
+        dst.turns += turns;
+        for (size_t i = 0; i < scoreSum.size(); ++i) { dst.scoreSum[i] += scoreSum[i]; dst.winSum[i] += winSum[i]; }
+        for (size_t i = 0; i < beatSum.size(); ++i) dst.beatSum[i] += beatSum[i];
+        for (size_t i = 0; i < filled.size(); ++i) dst.filled[i] += filled[i];
+    }
+    void clear() {
+        games = turns = 0;
+        fill(scoreSum.begin(), scoreSum.end(), 0);
+        fill(winSum.begin(), winSum.end(), 0.0);
+        fill(beatSum.begin(), beatSum.end(), 0.0);
+        fill(filled.begin(), filled.end(), 0);
+    }
+    void toResult(SimResult& r, double seconds) const {
+        const double g = games ? static_cast<double>(games) : 1.0;
+        r.games = games;
+        r.turns = turns;
+        r.seconds = seconds;
+        r.meanScore.assign(seats, 0.0);
+        r.winRate.assign(seats, 0.0);
+        r.headToHead.assign(seats * seats, 0.0);
+        r.fillRate.assign(seats, {});
+        for (size_t p = 0; p < seats; ++p) {
+            r.meanScore[p] = scoreSum[p] / g;
+            r.winRate[p] = winSum[p] / g;
+            for (int c = 0; c < CATS; ++c) r.fillRate[p][c] = filled[p * CATS + c] / g;
+        }
+        for (size_t i = 0; i < beatSum.size(); ++i) r.headToHead[i] = beatSum[i] / g;
+    }
+};
+
+// live   Ŀ     ȣ  踦  ִ  
+static SimResult simulate(const SimConfig& cfg, int refreshMs, const function<void(const SimResult&)>* live) {
+    const int threads = (std::max)(1, cfg.threads);
+    const size_t seats = cfg.seats.size();
+    SimResult result;
+    SimTally shared(seats);
+    if (cfg.keepTotals) result.totals.assign(static_cast<size_t>((std::max)(0, cfg.games)) * seats, 0);
+    atomic<int> nextGame{ 0 };
+    atomic<int> running{ 0 };
+    mutex mtx;
+    condition_variable done;
+    const auto flushEvery = chrono::milliseconds((std::max)(10, refreshMs / 2));
+
+    auto worker = [&](int idx, bool pooled) {
+        if (pooled) traceThreadName("sim worker");
+        seedRng(cfg.seed * 0x9E3779B97F4A7C15ull + idx);
+        SimTally local(seats);
+        vector<Scorecard> players(seats);
+        Dice dice{ 1, 1, 1, 1, 1 };
+        const int rounds = activeCategoryCount();
+        auto lastFlush = chrono::steady_clock::now();
+        int g;
+        while ((g = nextGame.fetch_add(1, memory_order_relaxed)) < cfg.games) {
+            for (auto& sc : players) sc.clearScores();
+            for (int round = 1; round <= rounds; ++round)
+                for (size_t p = 0; p < seats; ++p) playAITurn(players[p], dice, round, cfg.seats[p], nullptr, &players);
+            local.addGame(players, rounds);
+            if (cfg.keepTotals)
+                for (size_t p = 0; p < seats; ++p) result.totals[g * seats + p] = static_cast<int16_t>(players[p].total());
+            // ú尡  ȭ   ݸ  հ迡 ݿѴ
+            if (live && chrono::steady_clock::now() - lastFlush >= flushEvery) {
+                lock_guard<mutex> lock(mtx);
+                local.mergeInto(shared);
+                local.clear();
+                lastFlush = chrono::steady_clock::now();
+            }
+        }
+        lock_guard<mutex> lock(mtx);
+        local.mergeInto(shared);
+        if (--running == 0) done.notify_all();
+    };
+
+    auto t0 = chrono::steady_clock::now();
+    vector<thread> pool;
+    running = threads;
+    for (int i = live ? 0 : 1; i < threads; ++i) pool.emplace_back(worker, i, true);
+    if (!live) {
+        worker(0, false);
+    }
+    else {
+        SimResult snapshot;
+        unique_lock<mutex> lock(mtx);
+        while (!done.wait_for(lock, chrono::milliseconds((std::max)(10, refreshMs)), [&] { return running == 0; })) {
+            shared.toResult(snapshot, chrono::duration<double>(chrono::steady_clock::now() - t0).count());
+            lock.unlock();
+            (*live)(snapshot);          // ׸  Ŀ  ʵ  ۿ
+            lock.lock();
+        }
+    }
+    for (auto& t : pool) t.join();
+    shared.toResult(result, chrono::duration<double>(chrono::steady_clock::now() - t0).count());
+    if (live) (*live)(result);
+    return result;
+}
+
+SimResult runSimulation(const SimConfig& cfg) {
+    return simulate(cfg, 0, nullptr);
+}
+
+SimResult runSimulationLive(const SimConfig& cfg, int refreshMs, const function<void(const SimResult&)>& onRefresh) {
+    return simulate(cfg, refreshMs, onRefresh ? &onRefresh : nullptr);
+}
+
+void runAIBenchmark(int games, int threads) {
+    if (games < 1) games = 1;
+    if (threads < 1) threads = 1;
+    SimConfig cfg;
+    cfg.games = games;
+    cfg.threads = threads;
+    cfg.seats = { AIDifficulty::NORMAL, AIDifficulty::HARD, AIDifficulty::HARD };
+
+    cout << u8"AI  " << games << u8" ( 1 +  2),  " << threads << endl;
+    cout << setw(14) << left << u8"" << right << setw(12) << "games/s" << setw(14) << "decisions/s"
+        << setw(10) << u8"߷" << setw(12) << u8"׸ " << setw(12) << u8" " << endl;
+
+    auto row = [&](const char* label, bool enabled, bool reset) {
+        setDecisionCacheEnabled(enabled);
+        if (reset) resetDecisionCache();
+        DecisionCacheStats before = decisionCacheStats();
+        SimResult r = runSimulation(cfg);
+        DecisionCacheStats after = decisionCacheStats();
+        uint64_t hits = after.hits - before.hits, misses = after.misses - before.misses;
+        uint64_t decisions = hits + misses + (after.uncached - before.uncached);
+        double mean = 0;
+        for (double m : r.meanScore) mean += m;
+        mean /= r.meanScore.size();
+        cout << setw(14) << left << label << right << fixed << setprecision(1)
+            << setw(12) << r.games / r.seconds << setw(14) << setprecision(0) << decisions / r.seconds;
+        if (enabled) cout << setw(9) << setprecision(1) << 100.0 * hits / (hits + misses ? hits + misses : 1) << "%" << setw(12) << after.entries;
+        else cout << setw(10) << "-" << setw(12) << "-";
+        cout << setw(12) << setprecision(1) << mean << endl;
+        cfg.seed++;
+    };
+    row(u8"ĳ ", false, true);
+    row(u8"ĳ( )", true, true);
+    row(u8"ĳ()", true, false);
+
+    DecisionCacheStats st = decisionCacheStats();
+    cout << u8"ĳ 뷮 " << st.capacity << u8", ü " << st.evictions << endl;
+    setDecisionCacheEnabled(true);
+}
+
+
+// =================== Ģ å  ===================
+// å Ŀ     (īװ Լ ϳ,   Ź ٽ )
+static int legacyScore(Category cat, const Dice& d) {
+    switch (cat) {
+    case Category::ONES: return scoreUpper(d, 1);
+    case Category::TWOS: return scoreUpper(d, 2);
+    case Category::THREES: return scoreUpper(d, 3);
+    case Category::FOURS: return scoreUpper(d, 4);
+    case Category::FIVES: return scoreUpper(d, 5);
+    case Category::SIXES: return scoreUpper(d, 6);
+    case Category::THREE_KIND: return scoreThreeKind(d);
+    case Category::FOUR_KIND: return scoreFourKind(d);
+    case Category::FULL_HOUSE: return scoreFullHouse(d);
+    case Category::SMALL_STRAIGHT: return scoreSmallStraight(d);
+    case Category::LARGE_STRAIGHT: return scoreLargeStraight(d);
+    case Category::YAHTZEE: return scoreYahtzee(d);
+    case Category::CHANCE: return scoreChance(d);
+    default: return 0;
+    }
+}
+
+// Ʈ Ģ ״ ű   (Ŀ )
+static int yachtReference(Category cat, const Dice& d) {
+    auto c = countFace(d);
+    const int sum = sumDice(d);
+    switch (cat) {
+    case Category::THREE_KIND: return 0;
+    case Category::FOUR_KIND: for (int f = 1; f <= 6; f++) if (c[f] >= 4) return 4 * f; return 0;
+    case Category::FULL_HOUSE: return scoreFullHouse(d) ? sum : 0;
+    case Category::SMALL_STRAIGHT: return scoreSmallStraight(d) ? 15 : 0;
+    case Category::LARGE_STRAIGHT: return scoreLargeStraight(d) ? 30 : 0;
+    default: return legacyScore(cat, d);
+    }
+}
+
+template <class Fn>
+static double nsPerScore(const vector<Dice>& all, int passes, long long& checksum, Fn&& score) {
+    auto t0 = chrono::steady_clock::now();
+    for (int p = 0; p < passes; ++p)
+        for (const Dice& d : all)
+            for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) checksum += score(static_cast<Category>(c), d);
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+    return ns / (static_cast<double>(passes) * all.size() * static_cast<int>(Category::CATEGORY_COUNT));
+}
+
+void runRulesBenchmark(int games) {
+    if (games < 1) games = 1;
+    const RulesVariant saved = rulesVariant();
+    vector<Dice> all;
+    all.reserve(7776);
+    for (int n = 0; n < 7776; ++n) {
+        Dice d;
+        for (int i = 0, v = n; i < 5; ++i, v /= 6) d[i] = v % 6 + 1;
+        all.push_back(d);
+    }
+
+    // 1) Ŀ      ( ִ ֻ 7776 x 13ĭ)
+    int yahtzeeMismatch = 0, yachtMismatch = 0;
+    for (const Dice& d : all)
+        for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) {
+            Category cat = static_cast<Category>(c);
+            if (rules::Kernel<rules::YahtzeeRules>::score(cat, d.data()) != legacyScore(cat, d)) yahtzeeMismatch++;
+            if (rules::Kernel<rules::YachtRules>::score(cat, d.data()) != yachtReference(cat, d)) yachtMismatch++;
+        }
+    cout << u8"  (7776 x 13):  ġ " << yahtzeeMismatch << u8", Ʈ ġ " << yachtMismatch << endl;
+
+    // 2)     ð
+    long long checksum = 0;
+    const int passes = 50;
+    double legacyNs = nsPerScore(all, passes, checksum, legacyScore);
+    double yahtzeeNs = nsPerScore(all, passes, checksum, [](Category c, const Dice& d) { return rules::Kernel<rules::YahtzeeRules>::score(c, d.data()); });
+    double yachtNs = nsPerScore(all, passes, checksum, [](Category c, const Dice& d) { return rules::Kernel<rules::YachtRules>::score(c, d.data()); });
+    double dispatchNs = nsPerScore(all, passes, checksum, scoreCategory);
+    cout << fixed << setprecision(2)
+        << u8"īװ 1ĭ:  switch " << legacyNs << u8" ns,  Ŀ " << yahtzeeNs << u8" ns, Ʈ Ŀ " << yachtNs
+        << u8" ns, scoreCategory(Ģ б ) " << dispatchNs << " ns" << endl;
+
+    //  ϳ 13ĭ :  Լ 13 vs    б  ä
+    auto t0 = chrono::steady_clock::now();
+    for (int p = 0; p < passes; ++p)
+        for (const Dice& d : all)
+            for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) checksum += legacyScore(static_cast<Category>(c), d);
+    double legacyAllNs = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count() / (static_cast<double>(passes) * all.size());
+    t0 = chrono::steady_clock::now();
+    int out[static_cast<int>(Category::CATEGORY_COUNT)];
+    for (int p = 0; p < passes; ++p)
+        for (const Dice& d : all) {
+            rules::Kernel<rules::YahtzeeRules>::scoreAll(d.data(), out);
+            for (int v : out) checksum += v;
+        }
+    double kernelAllNs = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count() / (static_cast<double>(passes) * all.size());
+    cout << u8"13ĭ ü:  Լ 13 " << legacyAllNs << u8" ns, Ŀ scoreAll " << kernelAllNs << " ns  (checksum " << checksum << ")" << endl;
+
+    // 3) Ģ 帮  ( AI 2)
+    cout << setw(22) << left << u8"Ģ" << right << setw(10) << u8"" << setw(12) << "games/s" << setw(16) << u8" " << endl;
+    for (RulesVariant v : { RulesVariant::YAHTZEE, RulesVariant::YACHT }) {
+        setRulesVariant(v);
+        SimConfig cfg;
+        cfg.games = games;
+        cfg.threads = 1;
+        SimResult r = runSimulation(cfg);
+        double mean = 0;
+        for (double m : r.meanScore) mean += m;
+        mean /= r.meanScore.size();
+        cout << setw(22) << left << rulesName(v) << right << setw(10) << activeCategoryCount() << setprecision(1)
+            << setw(12) << r.games / r.seconds << setw(12) << mean << endl;
+    }
+    setRulesVariant(saved);
+}
\ No newline at end of file
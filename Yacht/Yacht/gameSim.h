@@ -0,0 +1,45 @@
+#pragma once
+#ifndef GAMESIM_H
+#define GAMESIM_H
+
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <functional>
+
+#include "gameLogic.h"
+#include "gameAI.h"
+
+using namespace std;
+
+// =================== 帮 AI  ùķ̼ ===================
+// ȭ   AI    忡  (帶 g_rng õ带  )
+struct SimConfig {
+    int games = 1000;
+    int threads = 1;
+    vector<AIDifficulty> seats{ AIDifficulty::HARD, AIDifficulty::HARD };
+    uint64_t seed = 1;
+    bool keepTotals = false;        // Ӻ   SimResult::totals   (DB ϰ Ͽ)
+};
+
+struct SimResult {
+    uint64_t games = 0;
+    uint64_t turns = 0;
+    double seconds = 0;
+    vector<double> meanScore;       // ¼  
+    vector<double> winRate;         // ¼ 1  ( 1  )
+    vector<double> headToHead;      // [a * ¼  + b] = a  b      ( )
+    vector<array<double, static_cast<size_t>(Category::CATEGORY_COUNT)>> fillRate;  // ¼, ĭ 0 ƴ  ä 
+    vector<int16_t> totals;         // keepTotals   [ * ¼  + ¼]  
+};
+
+SimResult runSimulation(const SimConfig& cfg);
+// Ŀ 常  , ȣ  refreshMs  ݱ  onRefresh  θ (   )
+SimResult runSimulationLive(const SimConfig& cfg, int refreshMs, const function<void(const SimResult&)>& onRefresh);
+
+//  ĳ   ʴ  /߷  ( --bench-ai)
+void runAIBenchmark(int games, int threads);
+// Ģ å Ŀ , Ģ   ð  ӵ  ( --bench-rules)
+void runRulesBenchmark(int games);
+
+#endif // GAMESIM_H
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "gameNet.h"
+#include "gameSpectate.h"
+#include "gameUI.h"
+
+//   ؼ. Ű̸ ̸ 
+static bool decodeSpectatorFrame(const char* p, size_t len, bool keyframe, int& round, int& lastRound, int& current, int& rollsLeft,
+    Dice& dice, array<bool, 5>& held, vector<Scorecard>& players) {
+    if (len < 20) return false;
+    round = static_cast<uint8_t>(p[8]);
+    lastRound = static_cast<uint8_t>(p[18]);
+    current = static_cast<uint8_t>(p[9]);
+    rollsLeft = static_cast<uint8_t>(p[10]);
+    for (int i = 0; i < 5; ++i) {
+        dice[i] = static_cast<uint8_t>(p[11 + i]);
+        held[i] = (static_cast<uint8_t>(p[16]) >> i) & 1;
+    }
+    size_t n = static_cast<uint8_t>(p[19]);
+    size_t off = 20 + n * 4;
+    if (len < off + n * 14) return false;
+    players.resize(n);
+    for (size_t i = 0; i < n; ++i, off += 14) {
+        uint16_t used = static_cast<uint8_t>(p[20 + i * 4]) | (static_cast<uint8_t>(p[21 + i * 4]) << 8);
+        for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) {
+            players[i].used[c] = (used >> c) & 1;
+            players[i].scores[c] = static_cast<uint8_t>(p[off + c]);
+        }
+        players[i].yahtzeeBonusCount = static_cast<uint8_t>(p[off + 13]);
+        players[i].recomputeTotals();
+    }
+    if (keyframe) {
+        for (size_t i = 0; i < n && off < len; ++i) {
+            size_t nameLen = static_cast<uint8_t>(p[off++]);
+            if (off + nameLen > len) return false;
+            players[i].name.assign(p + off, nameLen);
+            off += nameLen;
+        }
+    }
+    return true;
+}
+
+void run_spectator_client(const string& host, uint16_t port, uint32_t room) {
+    if (!netStartup()) return;
+    socket_t s = connectTcp(host, port);
+    if (s == INVALID_SOCK) {
+        cerr << "   ϴ." << endl;
+        return;
+    }
+    char req[4];
+    memcpy(req, &room, 4);
+    sendFrameBlocking(s, MsgType::SPECTATE, req, 4);
+    hideCursor(true);
+
+    vector<Scorecard> players;
+    Dice dice{ 1, 1, 1, 1, 1 };
+    array<bool, 5> held{};
+    int round = 0, lastRound = activeCategoryCount(), current = 0, rollsLeft = 3;
+    MsgType type; vector<char> payload;
+    while (recvFrameBlocking(s, type, payload)) {
+        if (type != MsgType::EVENT && type != MsgType::KEYFRAME) continue;
+        if (!decodeSpectatorFrame(payload.data(), payload.size(), type == MsgType::KEYFRAME, round, lastRound, current, rollsLeft, dice, held, players)) continue;
+        if (players.empty()) continue;
+        string status = round > lastRound ? u8" ϴ." : (round == 0 ? u8"  ٸ ..." : "");
+        redrawAll((std::max)(1, (std::min)(round, lastRound)), (std::min)(current, static_cast<int>(players.size()) - 1), rollsLeft, dice, held, players,
+            u8"[ ] â  մϴ.", "", status);
+    }
+    hideCursor(false);
+    closeSocket(s);
+}
\ No newline at end of file
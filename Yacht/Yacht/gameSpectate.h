@@ -0,0 +1,13 @@
+#pragma once
+#ifndef GAMESPECTATE_H
+#define GAMESPECTATE_H
+
+#include <string>
+#include <cstdint>
+
+using namespace std;
+
+//   ϸ ֿܼ redrawAll  ׸ ( --spectate)
+void run_spectator_client(const string& host, uint16_t port, uint32_t room);
+
+#endif // GAMESPECTATE_H
\ No newline at end of file
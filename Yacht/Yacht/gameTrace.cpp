@@ -0,0 +1,152 @@
+#include "gameTrace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <iostream>
+
+atomic<bool> g_traceEnabled{ false };
+
+// ĭ ʵ relaxed     Ϲ  ,   о   ƴϴ
+// ( ̺Ʈ ʵ尡    Ƿ  ʿ head  ٽ ȮѴ)
+struct TraceSlot {
+    atomic<const char*> name{ nullptr };
+    atomic<const char*> cat{ nullptr };
+    atomic<uint64_t> startNs{ 0 };
+    atomic<uint64_t> durNs{ 0 };
+};
+
+//  ϳ , (dump)  ٸ 尡 д´.     ̺Ʈ 
+struct TraceRing {
+    static constexpr size_t CAPACITY = 1 << 16;     //   2MB
+    TraceSlot events[CAPACITY];
+    atomic<uint64_t> head{ 0 };                     // ݱ  ̺Ʈ 
+    int tid = 0;
+    const char* threadName = nullptr;
+};
+
+static mutex g_ringsMutex;                          // ϰ    (̺Ʈ ⿡  )
+static vector<TraceRing*> g_rings;                  // 尡    ֵ  ʴ´
+static string g_tracePath = "trace.json";
+static const chrono::steady_clock::time_point g_traceEpoch = chrono::steady_clock::now();
+
+static FILE* openFile(const char* path, const char* mode) {
+#ifdef _MSC_VER
+    FILE* f = nullptr;
+    return fopen_s(&f, path, mode) == 0 ? f : nullptr;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+uint64_t traceNowNs() {
+    return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - g_traceEpoch).count());
+}
+
+TraceRing* traceThreadRing() {
+    static thread_local TraceRing* ring = nullptr;
+    if (!ring) {
+        TraceRing* r = new TraceRing();
+        lock_guard<mutex> lk(g_ringsMutex);
+        r->tid = static_cast<int>(g_rings.size()) + 1;
+        g_rings.push_back(r);
+        ring = r;
+    }
+    return ring;
+}
+
+void traceRecord(TraceRing* ring, const char* name, const char* cat, uint64_t startNs, uint64_t endNs) {
+    uint64_t h = ring->head.load(memory_order_relaxed);
+    //    ĭ   ôٸ head  h ̻ ̵ (x86  Ϸ 庮)
+    atomic_thread_fence(memory_order_release);
+    TraceSlot& e = ring->events[h & (TraceRing::CAPACITY - 1)];
+    e.name.store(name, memory_order_relaxed);
+    e.cat.store(cat, memory_order_relaxed);
+    e.startNs.store(startNs, memory_order_relaxed);
+    e.durNs.store(endNs - startNs, memory_order_relaxed);
+    ring->head.store(h + 1, memory_order_release);
+}
+
+void setTraceEnabled(bool enabled) { g_traceEnabled.store(enabled, memory_order_relaxed); }
+
+void traceThreadName(const char* name) {
+    if (traceEnabled()) traceThreadRing()->threadName = name;
+}
+
+static void writeJsonString(FILE* f, const char* s) {
+    fputc('"', f);
+    for (; s && *s; ++s) {
+        if (*s == '"' || *s == '\\') fputc('\\', f);
+        if (static_cast<unsigned char>(*s) >= 0x20) fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+long long traceDump(const char* path) {
+    FILE* f = openFile(path, "wb");
+    if (!f) return -1;
+    lock_guard<mutex> lk(g_ringsMutex);
+    long long written = 0;
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", f);
+    bool first = true;
+    for (TraceRing* r : g_rings) {
+        if (r->threadName) {
+            fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",\n", r->tid);
+            writeJsonString(f, r->threadName);
+            fputs("}}", f);
+            first = false;
+        }
+        //    ( /IO, ùķ̼ Ŀ,  ִ  Ҹ) д ȿ
+        // ۸    [begin, head)   ĭ   ִ. ׷ ĭ   head 
+        // ٽ о,    ĭ ٽ   ( head >= i + CAPACITY) 
+        //   ִ    ǳʶڴ.     head ձ
+        uint64_t head = r->head.load(memory_order_acquire);
+        uint64_t begin = head > TraceRing::CAPACITY ? head - TraceRing::CAPACITY : 0;
+        for (uint64_t i = begin; i < head; ++i) {
+            const TraceSlot& slot = r->events[i & (TraceRing::CAPACITY - 1)];
+            TraceEvent e;
+            e.name = slot.name.load(memory_order_relaxed);
+            e.cat = slot.cat.load(memory_order_relaxed);
+            e.startNs = slot.startNs.load(memory_order_relaxed);
+            e.durNs = slot.durNs.load(memory_order_relaxed);
+            atomic_thread_fence(memory_order_acquire);
+            const uint64_t now = r->head.load(memory_order_relaxed);
+            if (now >= i + TraceRing::CAPACITY) {
+                i = now - TraceRing::CAPACITY;      // ++i  now - CAPACITY + 1  (     ĭ)
+                continue;
+            }
+            fputs(first ? "{\"name\":" : ",\n{\"name\":", f);
+            writeJsonString(f, e.name);
+            fputs(",\"cat\":", f);
+            writeJsonString(f, e.cat);
+            // ts/dur  ũ  Ǽ (ns е )
+            fprintf(f, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%llu.%03u,\"dur\":%llu.%03u}", r->tid,
+                static_cast<unsigned long long>(e.startNs / 1000), static_cast<unsigned>(e.startNs % 1000),
+                static_cast<unsigned long long>(e.durNs / 1000), static_cast<unsigned>(e.durNs % 1000));
+            first = false;
+            written++;
+        }
+    }
+    fputs("\n]}\n", f);
+    fclose(f);
+    return written;
+}
+
+static void dumpAtExit() {
+    setTraceEnabled(false);
+    long long n = traceDump(g_tracePath.c_str());
+    if (n < 0) cerr << u8"    ϴ: " << g_tracePath << endl;
+    else cerr << u8" ̺Ʈ " << n << u8" " << g_tracePath << u8"  ߽ϴ." << endl;
+}
+
+void startTracing(const char* path) {
+    static bool registered = false;
+    if (path && *path) g_tracePath = path;
+    if (!registered) { atexit(dumpAtExit); registered = true; }
+    traceNowNs();
+    setTraceEnabled(true);
+    traceThreadName("main");
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+#ifndef GAMETRACE_H
+#define GAMETRACE_H
+
+#include <atomic>
+#include <cstdint>
+
+using namespace std;
+
+// ===================   ===================
+// TRACE_SCOPE("̸", "з")  Լ/  տ θ    ð (ns)
+// 庰  ۿ .   ڱ  ۿ Ƿ  ,
+//      ϳ а . ̸/з ڿ ͷ (͸ )
+//
+// Ѵ :  𿡵 --trace [.json] (⺻ trace.json).   Chrome/Perfetto 
+// trace event  ϹǷ chrome://tracing Ǵ ui.perfetto.dev    ִ
+// YACHT_NO_TRACE  ϰ ϸ TRACE_SCOPE  ƿ 
+//     ĭ   ̺Ʈ ϳ
+struct TraceEvent {
+    const char* name;
+    const char* cat;
+    uint64_t startNs;       //     ð
+    uint64_t durNs;
+};
+
+struct TraceRing;
+
+extern atomic<bool> g_traceEnabled;
+
+inline bool traceEnabled() { return g_traceEnabled.load(memory_order_relaxed); }
+uint64_t traceNowNs();
+TraceRing* traceThreadRing();                       //    (ó    )
+void traceRecord(TraceRing* ring, const char* name, const char* cat, uint64_t startNs, uint64_t endNs);
+
+class TraceScope {
+public:
+    TraceScope(const char* name, const char* cat) : name(name), cat(cat) {
+        if (traceEnabled()) { ring = traceThreadRing(); start = traceNowNs(); }
+    }
+    ~TraceScope() { if (ring) traceRecord(ring, name, cat, start, traceNowNs()); }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    const char* cat;
+    TraceRing* ring = nullptr;
+    uint64_t start = 0;
+};
+
+#ifdef YACHT_NO_TRACE
+#define TRACE_SCOPE(name, cat) ((void)0)
+#else
+#define TRACE_CONCAT2(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT2(a, b)
+#define TRACE_SCOPE(name, cat) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name, cat)
+#endif
+
+//  Ѱ  (atexit) path  ϵ Ѵ
+void startTracing(const char* path);
+void setTraceEnabled(bool enabled);
+void traceThreadName(const char* name);             //  ǥ  ̸ (ͷ)
+// ݱ  ̺Ʈ path  ϰ  ̺Ʈ  ȯ (-1 =  )
+long long traceDump(const char* path);
+
+#endif // GAMETRACE_H
\ No newline at end of file
@@ -1,4 +1,16 @@
 #include "gameUI.h"
+#include "gameReplay.h"
+#include "gameOdds.h"
+#include "gameAlloc.h"
+#include "gameTrace.h"
+#include "gameSim.h"
+#include "gameRules.h"
+
+#include <deque>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdarg>
+#include <cstring>
 
 // ===================    ===================
 const int LEFT_W = 36;
@@ -10,13 +22,6 @@ const int RIGHT_Y = 0;
 // =================== ܼ    Լ ===================
 #ifdef _WIN32
 HANDLE HOUT;
-wstring s2ws(const std::string& s) {
-    if (s.empty()) return L"";
-    int size_needed = MultiByteToWideChar(CP_UTF8, 0, &s[0], (int)s.size(), NULL, 0);
-    std::wstring wstrTo(size_needed, 0);
-    MultiByteToWideChar(CP_UTF8, 0, &s[0], (int)s.size(), &wstrTo[0], size_needed);
-    return wstrTo;
-}
 void hideCursor(bool hide) {
     CONSOLE_CURSOR_INFO ci;
     ci.dwSize = 20; ci.bVisible = hide ? FALSE : TRUE;
@@ -25,9 +30,12 @@ void hideCursor(bool hide) {
 void gotoXY(int x, int y) {
     COORD c; c.X = (SHORT)x; c.Y = (SHORT)y; SetConsoleCursorPosition(HOUT, c);
 }
-void writeAt(int x, int y, const string& s) {
+void writeAt(int x, int y, string_view s) {
     gotoXY(x, y);
-    wstring ws = s2ws(s);
+    static wstring ws;      // ȯ   (  Ŀ ڿ Ҵ )
+    int size_needed = s.empty() ? 0 : MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), NULL, 0);
+    ws.resize(size_needed);
+    if (size_needed) MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), &ws[0], size_needed);
     DWORD w;
     WriteConsoleW(HOUT, ws.c_str(), (DWORD)ws.size(), &w, nullptr);
 }
@@ -39,7 +47,18 @@ void ensureConsoleSize(int cols, int rows) {
     SMALL_RECT win = { 0, 0, (SHORT)(cols - 1), (SHORT)(rows - 1) };
     SetConsoleWindowInfo(HOUT, TRUE, &win);
 }
-void clearScreen() { system("cls"); }
+//   cls μ  ʰ ȭ ۸   (ܼ ƴϸ cls)
+void clearScreen() {
+    TRACE_SCOPE("ui.clearScreen", "ui");
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (!GetConsoleScreenBufferInfo(HOUT, &csbi)) { system("cls"); return; }
+    const DWORD cells = static_cast<DWORD>(csbi.dwSize.X) * csbi.dwSize.Y;
+    const COORD home = { 0, 0 };
+    DWORD w;
+    FillConsoleOutputCharacterW(HOUT, L' ', cells, home, &w);
+    FillConsoleOutputAttribute(HOUT, csbi.wAttributes, cells, home, &w);
+    SetConsoleCursorPosition(HOUT, home);
+}
 int getConsoleCols() {
     CONSOLE_SCREEN_BUFFER_INFO csbi;
     GetConsoleScreenBufferInfo(HOUT, &csbi);
@@ -53,13 +72,31 @@ int getConsoleRows() {
 #else
 void hideCursor(bool hide) { if (hide) cout << "\x1b[?25l"; else cout << "\x1b[?25h"; }
 void gotoXY(int x, int y) { cout << "\x1b[" << (y + 1) << ";" << (x + 1) << "H"; }
-void writeAt(int x, int y, const string& s) { gotoXY(x, y); cout << s; cout.flush(); }
+void writeAt(int x, int y, string_view s) { gotoXY(x, y); cout.write(s.data(), s.size()); cout.flush(); }
 void ensureConsoleSize(int, int) {}
-void clearScreen() { system("clear"); }
+void clearScreen() { TRACE_SCOPE("ui.clearScreen", "ui"); cout << "\x1b[H\x1b[2J\x1b[3J"; cout.flush(); }    // clear   Ͱ  
 int getConsoleCols() { return 120; }
 int getConsoleRows() { return 60; }
 #endif
 
+// /  ̸   ڿ պκи  (Ź string(width, ' ')   )
+static string_view repeatedChars(char ch, int width) {
+    static const string dashes(512, '-'), blanks(512, ' ');
+    const string& src = (ch == '-') ? dashes : blanks;
+    return string_view(src).substr(0, static_cast<size_t>(max(0, min(width, static_cast<int>(src.size())))));
+}
+string_view blankCells(int width) { return repeatedChars(' ', width); }
+
+//  ϳ printf  out  δ (ostringstream , Ҵ )
+static void appendf(string& out, const char* fmt, ...) {
+    char tmp[128];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(tmp, sizeof(tmp), fmt, ap);
+    va_end(ap);
+    if (n > 0) out.append(tmp, static_cast<size_t>(min(n, static_cast<int>(sizeof(tmp)) - 1)));
+}
+
 // ƿ:  м// 
 void drawVerticalSep(int col, int y_top, int y_bottom, const string& glyph) {
     for (int y = y_top; y <= y_bottom; ++y) writeAt(col, y, glyph);
@@ -67,162 +104,370 @@ void drawVerticalSep(int col, int y_top, int y_bottom, const string& glyph) {
 void drawHRule(int x, int y) {
     int cols = getConsoleCols();
     int width = max(1, cols - x - 1);
-    writeAt(x, y, string(width, '-'));
+    writeAt(x, y, repeatedChars('-', width));
 }
 void clearRightPaneFrom(int start_y) {
     int cols = getConsoleCols();
     int rows = getConsoleRows();
     int width = max(1, cols - RIGHT_X - 1);
-    for (int y = start_y; y < rows; ++y) writeAt(RIGHT_X, y, string(width, ' '));
+    for (int y = start_y; y < rows; ++y) writeAt(RIGHT_X, y, blankCells(width));
 }
-int getVisualWidth(const string& s) {
+// =================== ǥ  ===================
+// ڵ Ʈ ϳ ϴ ĭ  (Unicode East Asian Width )
+//  W/F(ѱ , ,  ȣ, ׸ ) = 2,  /   = 0
+//  A( ׸, ׸ , Ϻ ȣ  ȣ ) = ambiguousWidth (ѱ Ž ܼ 2, ڵ ͹̳  1)
+struct CodeRange { char32_t lo, hi; };
+static const CodeRange ZERO_WIDTH[] = {
+    { 0x0300, 0x036F }, { 0x0483, 0x0489 }, { 0x0591, 0x05BD }, { 0x1160, 0x11FF }, { 0x200B, 0x200F },
+    { 0x2028, 0x202E }, { 0x2060, 0x2064 }, { 0x20D0, 0x20FF }, { 0x302A, 0x302F }, { 0x3099, 0x309A },
+    { 0xD7B0, 0xD7FF }, { 0xFE00, 0xFE0F }, { 0xFE20, 0xFE2F }, { 0xFEFF, 0xFEFF }, { 0xE0100, 0xE01EF },
+};
+static const CodeRange WIDE[] = {
+    { 0x1100, 0x115F }, { 0x231A, 0x231B }, { 0x2329, 0x232A }, { 0x23E9, 0x23EC }, { 0x23F0, 0x23F0 },
+    { 0x23F3, 0x23F3 }, { 0x25FD, 0x25FE }, { 0x2614, 0x2615 }, { 0x2648, 0x2653 }, { 0x267F, 0x267F },
+    { 0x2693, 0x2693 }, { 0x26A1, 0x26A1 }, { 0x26AA, 0x26AB }, { 0x26BD, 0x26BE }, { 0x26C4, 0x26C5 },
+    { 0x26CE, 0x26CE }, { 0x26D4, 0x26D4 }, { 0x26EA, 0x26EA }, { 0x26F2, 0x26F3 }, { 0x26F5, 0x26F5 },
+    { 0x26FA, 0x26FA }, { 0x26FD, 0x26FD }, { 0x2705, 0x2705 }, { 0x270A, 0x270B }, { 0x2728, 0x2728 },
+    { 0x274C, 0x274C }, { 0x274E, 0x274E }, { 0x2753, 0x2755 }, { 0x2757, 0x2757 }, { 0x2795, 0x2797 },
+    { 0x27B0, 0x27B0 }, { 0x27BF, 0x27BF }, { 0x2B1B, 0x2B1C }, { 0x2B50, 0x2B50 }, { 0x2B55, 0x2B55 },
+    { 0x2E80, 0x303E }, { 0x3041, 0x33FF }, { 0x3400, 0x4DBF }, { 0x4E00, 0x9FFF }, { 0xA000, 0xA4CF },
+    { 0xA960, 0xA97F }, { 0xAC00, 0xD7A3 }, { 0xF900, 0xFAFF }, { 0xFE10, 0xFE19 }, { 0xFE30, 0xFE6F },
+    { 0xFF00, 0xFF60 }, { 0xFFE0, 0xFFE6 }, { 0x1F300, 0x1F64F }, { 0x1F680, 0x1F6FF }, { 0x1F900, 0x1F9FF },
+    { 0x20000, 0x2FFFD }, { 0x30000, 0x3FFFD },
+};
+static const CodeRange AMBIGUOUS[] = {
+    { 0x00A1, 0x00A1 }, { 0x00A4, 0x00A4 }, { 0x00A7, 0x00A8 }, { 0x00AA, 0x00AA }, { 0x00AD, 0x00AE },
+    { 0x00B0, 0x00B4 }, { 0x00B6, 0x00BA }, { 0x00BC, 0x00BF }, { 0x00C6, 0x00C6 }, { 0x00D0, 0x00D0 },
+    { 0x00D7, 0x00D8 }, { 0x00DE, 0x00E1 }, { 0x00E6, 0x00E6 }, { 0x00E8, 0x00EA }, { 0x00EC, 0x00ED },
+    { 0x00F0, 0x00F0 }, { 0x00F2, 0x00F3 }, { 0x00F7, 0x00FA }, { 0x00FC, 0x00FC }, { 0x00FE, 0x00FE },
+    { 0x0391, 0x03A9 }, { 0x03B1, 0x03C9 }, { 0x0401, 0x0401 }, { 0x0410, 0x044F }, { 0x0451, 0x0451 },
+    { 0x2010, 0x2027 }, { 0x2030, 0x203E }, { 0x2100, 0x215F }, { 0x2160, 0x2189 }, { 0x2190, 0x21FF },
+    { 0x2200, 0x22FF }, { 0x2312, 0x2312 }, { 0x2460, 0x24FF }, { 0x2500, 0x25FF }, { 0x2600, 0x26FF },
+    { 0x273D, 0x273D }, { 0x2776, 0x277F }, { 0x3248, 0x324F }, { 0xE000, 0xF8FF }, { 0xFFFD, 0xFFFD },
+};
+
+template <size_t N>
+static bool inRanges(const CodeRange (&table)[N], char32_t cp) {
+    if (cp < table[0].lo || cp > table[N - 1].hi) return false;
+    size_t lo = 0, hi = N;
+    while (lo < hi) {                       // ǥ lo , ġ 
+        const size_t mid = (lo + hi) / 2;
+        if (cp > table[mid].hi) lo = mid + 1;
+        else if (cp < table[mid].lo) hi = mid;
+        else return true;
+    }
+    return false;
+}
+
+#ifdef _WIN32
+static int g_ambiguousWidth = 2;
+#else
+static int g_ambiguousWidth = 1;
+#endif
+void setAmbiguousWidth(int cells) { g_ambiguousWidth = cells == 2 ? 2 : 1; }
+
+enum WidthClass : uint8_t { WC_ZERO, WC_NARROW, WC_WIDE, WC_AMBIGUOUS, WC_MIXED };
+
+static WidthClass searchWidthClass(char32_t cp) {
+    if (cp < 0xA0) return WC_ZERO;
+    if (inRanges(ZERO_WIDTH, cp)) return WC_ZERO;
+    if (inRanges(WIDE, cp)) return WC_WIDE;
+    if (inRanges(AMBIGUOUS, cp)) return WC_AMBIGUOUS;
+    return WC_NARROW;
+}
+
+// BMP  64 ڵ Ʈ    ü  ̸ ǥ Ž  ٷ Ѵ (ù ȣ    )
+constexpr int WIDTH_BLOCK_SHIFT = 6;
+constexpr int WIDTH_BLOCKS = 0x10000 >> WIDTH_BLOCK_SHIFT;
+
+static const array<uint8_t, WIDTH_BLOCKS>& bmpBlockClass() {
+    static const array<uint8_t, WIDTH_BLOCKS> blocks = [] {
+        array<uint8_t, WIDTH_BLOCKS> b{};
+        for (char32_t blk = 0; blk < WIDTH_BLOCKS; ++blk) {
+            const char32_t base = blk << WIDTH_BLOCK_SHIFT;
+            const WidthClass first = searchWidthClass(base);
+            b[blk] = first;
+            for (char32_t k = 1; k < (1u << WIDTH_BLOCK_SHIFT); ++k) {
+                if (searchWidthClass(base + k) != first) { b[blk] = WC_MIXED; break; }
+            }
+        }
+        return b;
+    }();
+    return blocks;
+}
+
+static int tableWidth(char32_t cp) {
+    WidthClass wc = WC_MIXED;
+    if (cp < 0x10000) wc = static_cast<WidthClass>(bmpBlockClass()[cp >> WIDTH_BLOCK_SHIFT]);
+    if (wc == WC_MIXED) wc = searchWidthClass(cp);
+    switch (wc) {
+    case WC_ZERO: return 0;
+    case WC_WIDE: return 2;
+    case WC_AMBIGUOUS: return g_ambiguousWidth;
+    default: return 1;
+    }
+}
+int codepointWidth(char32_t cp) {
+    if (cp < 0x80) return 1;
+    if (cp - 0xAC00u <= 0xD7A3u - 0xAC00u) return 2;     // ѱ  (ȭ  κ) ǥ  
+    return tableWidth(cp);
+}
+
+// s[i]  ϴ UTF-8  ڸ Ǯ Ʈ  ȯ (߸ Ʈ 1Ʈ¥ U+FFFD)
+static size_t decodeUtf8(string_view s, size_t i, char32_t& cp) {
+    const unsigned char c = static_cast<unsigned char>(s[i]);
+    size_t len = (c < 0x80) ? 1 : (c >= 0xC2 && c < 0xE0) ? 2 : (c >= 0xE0 && c < 0xF0) ? 3 : (c >= 0xF0 && c < 0xF5) ? 4 : 0;
+    if (len == 0 || i + len > s.size()) { cp = 0xFFFD; return 1; }
+    cp = (len == 1) ? c : (c & (0x7F >> len));
+    for (size_t k = 1; k < len; ++k) {
+        const unsigned char cc = static_cast<unsigned char>(s[i + k]);
+        if ((cc & 0xC0) != 0x80) { cp = 0xFFFD; return 1; }
+        cp = (cp << 6) | (cc & 0x3F);
+    }
+    return len;
+}
+
+int getVisualWidth(string_view s) {
     int width = 0;
-    for (size_t i = 0; i < s.length(); ) {
-        unsigned char ch = s[i];
-        if (ch < 0x80) { width++; i++; }
-        else {
-            width += 2;
-            if ((ch & 0xE0) == 0xC0) i += 2;
-            else if ((ch & 0xF0) == 0xE0) i += 3;
-            else i++;
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+    const unsigned char* const end = p + s.size();
+    // ASCII  : 8Ʈ ֻ Ʈ ϳ  Ʈ  = ĭ  ( ڴ ȭ ڿ ٰ )
+    while (end - p >= 8) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        if (w & 0x8080808080808080ull) break;
+        width += 8;
+        p += 8;
+    }
+    while (p < end) {
+        const unsigned c = *p;
+        if (c < 0x80) { width++; p++; continue; }
+        // 3Ʈ (ѱ//ȣ κ) ٷ Ǯ ѱ ̸ ǥ  ʴ´
+        if ((c & 0xF0) == 0xE0 && end - p >= 3 && ((p[1] & 0xC0) | ((p[2] & 0xC0) >> 2)) == 0xA0) {
+            const char32_t cp = ((c & 0x0Fu) << 12) | ((p[1] & 0x3Fu) << 6) | (p[2] & 0x3Fu);
+            width += (cp - 0xAC00u <= 0xD7A3u - 0xAC00u) ? 2 : tableWidth(cp);
+            p += 3;
+            continue;
         }
+        if (c >= 0xC2 && c < 0xE0 && end - p >= 2 && (p[1] & 0xC0) == 0x80) {
+            width += tableWidth(((c & 0x1Fu) << 6) | (p[1] & 0x3Fu));
+            p += 2;
+            continue;
+        }
+        char32_t cp;
+        const size_t i = static_cast<size_t>(p - reinterpret_cast<const unsigned char*>(s.data()));
+        p += decodeUtf8(s, i, cp);
+        width += codepointWidth(cp);
     }
     return width;
 }
-string fitName(const string& s, int maxCells) {
-    string out; int cells = 0;
+void appendFitName(string& out, string_view s, int maxCells) {
+    int cells = 0;
     for (size_t i = 0; i < s.size();) {
-        unsigned char ch = static_cast<unsigned char>(s[i]);
-        int add = (ch < 0x80) ? 1 : 2;
+        char32_t cp;
+        const size_t len = decodeUtf8(s, i, cp);
+        const int add = codepointWidth(cp);
         if (cells + add > maxCells) break;
-        if (add == 1) { out.push_back(s[i]); i++; }
-        else { out.append(s.substr(i, 3)); i += 3; }
+        out.append(s.substr(i, len));
+        i += len;
         cells += add;
     }
     out.append(maxCells - cells, ' ');
+}
+string fitName(const string& s, int maxCells) {
+    string out;
+    appendFitName(out, s, maxCells);
     return out;
 }
-vector<string> renderDie(int v, bool held) {
-    vector<string> g = {
+
+// ===================  ڻ ĳ ===================
+//  󺧰 ֻ ׸ Ģ/ĭ/ ޷ Ƿ Ģ ó    д
+static const int ALIGN_COL = 26;            //   ": " 
+static const int PREVIEW_COL = 28;          //   "= "  (Ʈ Ѹ 22)
+static const int PREVIEW_COL_HINT = 22;
+
+static DieArt makeDieArt(int face, bool held) {
+    DieArt g = {
         "+-------+",
         "|       |",
         "|       |",
         "|       |",
         "+-------+"
     };
-    if (v < 1 || v > 6) return g;
     auto setp = [&](int r, int c) { g[r][c] = 'o'; };
-    if (v == 1 || v == 3 || v == 5) setp(2, 4);
-    if (v >= 2) { setp(1, 2); setp(3, 6); }
-    if (v >= 4) { setp(1, 6); setp(3, 2); }
-    if (v == 6) { setp(2, 2); setp(2, 6); }
-    if (held) g[0] = "H=======H";
+    if (face == 1 || face == 3 || face == 5) setp(2, 4);
+    if (face >= 2) { setp(1, 2); setp(3, 6); }
+    if (face >= 4) { setp(1, 6); setp(3, 2); }
+    if (face == 6) { setp(2, 2); setp(2, 6); }
+    if (held && face != 0) g[0] = "H=======H";
     return g;
 }
-int scorePreviewLine(Category i, const Dice& d, const Scorecard& sc) {
-    if (isYahtzee(d) && sc.used[static_cast<int>(Category::YAHTZEE)] && sc.scores[static_cast<int>(Category::YAHTZEE)] > 0) {
-        switch (i) {
-        case Category::FULL_HOUSE: return FULL_HOUSE_SCORE;
-        case Category::SMALL_STRAIGHT: return SMALL_STRAIGHT_SCORE;
-        case Category::LARGE_STRAIGHT: return LARGE_STRAIGHT_SCORE;
-        case Category::ONES: case Category::TWOS: case Category::THREES: case Category::FOURS: case Category::FIVES: case Category::SIXES:
-            if (!sc.used[d[0] - 1]) return scoreUpper(d, d[0]);
-        default: return scoreCategory(i, d);
-        }
+
+static string padTo(string s, int col) {
+    s.append(max(1, col - getVisualWidth(s)), ' ');
+    return s;
+}
+
+static RenderAssets buildRenderAssets(RulesVariant v) {
+    RenderAssets a;
+    char num[16];
+    for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) {
+        snprintf(num, sizeof(num), " %2d) ", c + 1);
+        const string label = string(num) + string(categoryName(static_cast<Category>(c), v));
+        a.scoreLabel[c] = padTo(label, ALIGN_COL) + ": ";
+        a.previewLabel[0][c] = padTo(label, PREVIEW_COL) + "= ";
+        a.previewLabel[1][c] = padTo(label, PREVIEW_COL_HINT) + "= ";
     }
-    return scoreCategory(i, d);
+    a.subtotalLabel = padTo(u8"  Ż", ALIGN_COL) + ": ";
+    rules::withRules(v, [&](auto r) {
+        using R = decltype(r);
+        a.upperBonusThreshold = R::UPPER_BONUS_THRESHOLD;
+        a.bonusLabel = padTo(u8" +" + to_string(R::UPPER_BONUS) + u8" ʽ", ALIGN_COL) + ": ";
+    });
+    a.yahtzeeBonusPrefix = u8"  ʽ x ";
+    a.yahtzeeBonusPrefixWidth = getVisualWidth(a.yahtzeeBonusPrefix);
+    for (int face = 0; face <= 6; ++face)
+        for (int h = 0; h < 2; ++h) a.dice[face][h] = makeDieArt(face, h != 0);
+    return a;
+}
+
+const RenderAssets& renderAssets(RulesVariant v) {
+    static const array<RenderAssets, static_cast<size_t>(RulesVariant::COUNT)> all = []() {
+        array<RenderAssets, static_cast<size_t>(RulesVariant::COUNT)> r;
+        for (int i = 0; i < static_cast<int>(RulesVariant::COUNT); ++i) r[i] = buildRenderAssets(static_cast<RulesVariant>(i));
+        return r;
+    }();
+    return all[static_cast<size_t>(v)];
+}
+const RenderAssets& renderAssets() { return renderAssets(rulesVariant()); }
+
+// ֻ ׸ ( 0~6) x (Ȧ ) 14 (0 =  ֻ). Ģ 
+const DieArt& renderDie(int v, bool held) {
+    const RenderAssets& a = renderAssets(RulesVariant::YAHTZEE);
+    if (v < 1 || v > 6) return a.dice[0][0];
+    return a.dice[v][held ? 1 : 0];
+}
+int scorePreviewLine(Category i, const Dice& d, const Scorecard& sc) {
+    return scoreWithJoker(i, d, sc);
 }
 void redrawDiceOnly(const Dice& dice, const array<bool, 5>& held, int start_y) {
-    vector<vector<string>> arts; arts.reserve(5);
-    for (int i = 0; i < 5; ++i) arts.push_back(renderDie(dice[i], held[i]));
+    TRACE_SCOPE("ui.redrawDice", "ui");
+    static string line;
     for (int r = 0; r < 5; r++) {
-        ostringstream line;
-        for (int i = 0; i < 5; i++) line << arts[i][r] << ' ';
-        writeAt(RIGHT_X, start_y + 1 + r, line.str());
+        line.clear();
+        for (int i = 0; i < 5; i++) { line += renderDie(dice[i], held[i])[r]; line += ' '; }
+        writeAt(RIGHT_X, start_y + 1 + r, line);
     }
 }
-void displayImpactEffect(const string& combinationName) {
+void displayImpactEffect(string_view combinationName) {
     int effectX = RIGHT_X + 53;
     int effectY = RIGHT_Y + 9;
-    string border = "+-------------------------+";
-    string empty = "|                         |";
-    string text = "!! " + combinationName + " !!";
+    const string_view border = "+-------------------------+";
+    const string_view empty = "|                         |";
+    static string text;
+    text.assign("!! ").append(combinationName).append(" !!");
     int textX = effectX + (border.length() - getVisualWidth(text)) / 2;
     writeAt(effectX, effectY, border);
     writeAt(effectX, effectY + 1, empty);
     writeAt(textX, effectY + 2, text);
     writeAt(effectX, effectY + 3, empty);
     writeAt(effectX, effectY + 4, border);
+    TRACE_SCOPE("sleep.impactEffect", "sleep");
     this_thread::sleep_for(chrono::milliseconds(1500));
 }
-void redrawAll(int round, int p_idx, int rollsLeft, const Dice& dice, const array<bool, 5>& held, const vector<Scorecard>& players, const string& promptMsg, const string& errorMsg, const string& statusMsg) {
+static bool g_hintPanel = false;
+void setHintPanel(bool visible) { g_hintPanel = visible; }
+bool hintPanelVisible() { return g_hintPanel; }
+
+static RenderStats g_renderStats;
+const RenderStats& renderStats() { return g_renderStats; }
+void resetRenderStats() { g_renderStats = RenderStats{}; }
+
+void redrawAll(int round, int p_idx, int rollsLeft, const Dice& dice, const array<bool, 5>& held, const vector<Scorecard>& players, string_view promptMsg, string_view errorMsg, string_view statusMsg) {
+    TRACE_SCOPE("ui.redrawAll", "ui");
+    AllocSpan frameSpan(allocFrameStats());
     clearScreen();
+    const auto frameStart = chrono::steady_clock::now();
+    const RenderAssets& assets = renderAssets();
+
+    // ٸ  ڿ/Ʈ  ʰ   ϳ  ä 
+    static string line;
+    line.reserve(256);
 
     //  г 
-    writeAt(LEFT_X, LEFT_Y, u8"      ==   ==");
+    const bool yachtRules = rulesVariant() == RulesVariant::YACHT;
+    writeAt(LEFT_X, LEFT_Y, yachtRules ? u8"      == Ʈ  ==" : u8"      ==   ==");
     //  м
     drawVerticalSep(LEFT_W, 1, getConsoleRows() - 1);
 
     const Scorecard& sc = players[p_idx];
     int y = LEFT_Y + 2;
-    const int ALIGN_COL = 26;
+
+    // ȣ ̸ ڸ    ä īװ  ( ڻ ĳ)
+    auto categoryLine = [&](int i) {
+        if (!categoryActive(static_cast<Category>(i))) return;     // Ģ  ĭ ° 
+        line.assign(assets.scoreLabel[i]);
+        if (sc.used[i]) appendf(line, "%d", sc.scores[i]);
+        else line += u8"(̻)";
+        writeAt(LEFT_X, y++, line);
+        };
+    auto labeledValue = [&](const string& label, int value, int outOf) {
+        line.assign(label);
+        if (outOf > 0) appendf(line, "%d / %d", value, outOf);
+        else appendf(line, "%d", value);
+        writeAt(LEFT_X, y++, line);
+        };
 
     // () 1~6
-    for (int i = 0; i <= static_cast<int>(Category::SIXES); ++i) {
-        ostringstream line_prefix;
-        line_prefix << " " << setw(2) << (i + 1) << ") " << CAT_NAME[i];
-        string prefix_str = line_prefix.str();
-        int padding = ALIGN_COL - getVisualWidth(prefix_str);
-        if (padding < 1) padding = 1;
-        ostringstream final_line;
-        final_line << prefix_str << string(padding, ' ') << ": " << (sc.used[i] ? to_string(sc.scores[i]) : u8"(̻)");
-        writeAt(LEFT_X, y++, final_line.str());
-    }
+    for (int i = 0; i <= static_cast<int>(Category::SIXES); ++i) categoryLine(i);
     y++;
 
     // () Ż/ʽ
-    string subTotalStr = u8"  Ż";
-    writeAt(LEFT_X, y++, subTotalStr + string(ALIGN_COL - getVisualWidth(subTotalStr), ' ') + ": " + to_string(sc.upperSum()) + " / " + to_string(UPPER_BONUS_THRESHOLD));
-    string bonusStr = u8" +35 ʽ";
-    writeAt(LEFT_X, y++, bonusStr + string(ALIGN_COL - getVisualWidth(bonusStr), ' ') + ": " + to_string(sc.upperBonus()));
+    labeledValue(assets.subtotalLabel, sc.upperSum(), assets.upperBonusThreshold);
+    labeledValue(assets.bonusLabel, sc.upperBonus(), 0);
     y++;
 
     //  () 7~13 
-    for (int i = static_cast<int>(Category::THREE_KIND); i <= static_cast<int>(Category::CHANCE); ++i) {
-        ostringstream line_prefix;
-        line_prefix << " " << setw(2) << (i + 1) << ") " << CAT_NAME[i];
-        string prefix_str = line_prefix.str();
-        int padding = ALIGN_COL - getVisualWidth(prefix_str);
-        if (padding < 1) padding = 1;
-        ostringstream final_line;
-        final_line << prefix_str << string(padding, ' ')
-            << ": " << (sc.used[i] ? to_string(sc.scores[i]) : u8"(̻)");
-        writeAt(LEFT_X, y++, final_line.str());
-    }
+    for (int i = static_cast<int>(Category::THREE_KIND); i <= static_cast<int>(Category::CHANCE); ++i) categoryLine(i);
     y++;
 
-    // ()  ʽ//÷̾ 
-    string yahtzeeBonusStr = u8"  ʽ x " + to_string(sc.yahtzeeBonusCount);
-    writeAt(LEFT_X, y++, yahtzeeBonusStr + string(ALIGN_COL - getVisualWidth(yahtzeeBonusStr), ' ') + ": " + to_string(sc.yahtzeeBonusCount * YAHTZEE_BONUS_SCORE));
+    // ()  ʽ( Ģ)//÷̾ 
+    if (!yachtRules) {
+        line.assign(assets.yahtzeeBonusPrefix);
+        const size_t before = line.size();
+        appendf(line, "%d", sc.yahtzeeBonusCount);
+        line.append(max(0, ALIGN_COL - assets.yahtzeeBonusPrefixWidth - static_cast<int>(line.size() - before)), ' ');
+        appendf(line, ": %d", sc.yahtzeeBonusCount * YAHTZEE_BONUS_SCORE);
+        writeAt(LEFT_X, y++, line);
+    }
     y++;
-    writeAt(LEFT_X, y++, u8" : " + to_string(sc.total()));
+    line.assign(u8" : ");
+    appendf(line, "%d", sc.total());
+    writeAt(LEFT_X, y++, line);
     y += 2;
     writeAt(LEFT_X, y++, u8"--- ÷̾   ---");
     for (size_t i = 0; i < players.size(); ++i) {
         const auto& pl = players[i];
-        ostringstream line; line << (pl.name == sc.name ? " > " : "   ") << fitName(pl.name, 10) << " : " << pl.total();
-        writeAt(LEFT_X, y++, line.str());
+        line.assign(pl.name == sc.name ? " > " : "   ");
+        appendFitName(line, pl.name, 10);
+        appendf(line, " : %d", pl.total());
+        writeAt(LEFT_X, y++, line);
     }
 
     //  г 
-    ostringstream hdr; hdr << u8"---  " << round << u8" / 13 --- (" << sc.name << u8" )";
-    writeAt(RIGHT_X, RIGHT_Y, hdr.str());
-    ostringstream rollsStr; rollsStr << u8" : " << rollsLeft; writeAt(RIGHT_X, RIGHT_Y + 1, rollsStr.str());
+    line.assign(u8"---  ");
+    appendf(line, "%d", round);
+    appendf(line, " / %d", activeCategoryCount());
+    line.append(u8" --- (").append(sc.name).append(u8" )");
+    writeAt(RIGHT_X, RIGHT_Y, line);
+    line.assign(u8" : ");
+    appendf(line, "%d", rollsLeft);
+    writeAt(RIGHT_X, RIGHT_Y + 1, line);
 
     int guide_y = RIGHT_Y + 3;
     drawHRule(RIGHT_X, guide_y++);
     writeAt(RIGHT_X, guide_y++, u8"Ģ: ֻ ִ 3   ֽϴ.");
-    writeAt(RIGHT_X, guide_y++, u8"Է: [T] Ȧ, [R] ٽ , [S]  ");
+    writeAt(RIGHT_X, guide_y++, u8"Է: [T] Ȧ, [R] ٽ , [S]  , [H] Ʈ");
     writeAt(RIGHT_X, guide_y++, u8": T 1 3 (1, 3 ֻ Ȧ/մϴ)");
     drawHRule(RIGHT_X, guide_y++);
 
@@ -230,28 +475,44 @@ void redrawAll(int round, int p_idx, int rollsLeft, const Dice& dice, const arra
     redrawDiceOnly(dice, held, dice_start_y);
     writeAt(RIGHT_X, dice_start_y + 6, "   (1)      (2)      (3)      (4)      (5)");
 
+    // Ʈ г:     (Ȯ Ŷ Ȧ带 ٲ  ٽ ص 1ms ̸)
+    const bool showHint = g_hintPanel && rollsLeft > 0 && rollsLeft < 3;
+    OddsHint hint;
+    if (showHint) {
+        computeOddsHint(dice, held, sc.used, rollsLeft, hint);
+        for (int i = 0; i < 5; ++i) if (hint.bestHold[i]) writeAt(RIGHT_X + i * 10 + 1, dice_start_y + 7, u8"^õ^");
+        line.assign(u8"õ Ȧ 밪 ");
+        appendf(line, "%.1f", hint.bestHoldEV);
+        line += u8" /  Ȧ ";
+        appendf(line, "%.1f", hint.currentHoldEV);
+        line += u8"  ( ";
+        appendf(line, "%.2f ms)", hint.computeMs);
+        writeAt(RIGHT_X, dice_start_y + 8, line);
+    }
+
     int potential_y = dice_start_y + 9;
     writeAt(RIGHT_X, potential_y, u8"--------------------------  ֻ   -----------------------------");
-    if (isYahtzee(dice) && sc.used[static_cast<int>(Category::YAHTZEE)] && sc.scores[static_cast<int>(Category::YAHTZEE)] > 0)
+    if (!yachtRules && isYahtzee(dice) && sc.used[static_cast<int>(Category::YAHTZEE)] && sc.scores[static_cast<int>(Category::YAHTZEE)] > 0)
         writeAt(RIGHT_X, potential_y, u8"--------------------------  ֻ   (Ŀ!) -----------------------------");
+    if (showHint) writeAt(RIGHT_X, potential_y + 1, u8"   ( =   , Ȯ/밪 =  īװ  ּ  )");
 
     //      : +3 ( ٷ Ʒ +1,  +2,   )
     int rowL = potential_y + 3;
     int rowR = potential_y + 3;
 
     // ()   2Į
-    const int PREVIEW_COL_GAP = 37;
+    const int PREVIEW_COL_GAP = showHint ? 40 : 37;
     const int leftX = RIGHT_X;
     const int rightX = RIGHT_X + PREVIEW_COL_GAP;
 
     auto printPreview = [&](int idx, int x, int& yrow) {
-        ostringstream line_prefix; line_prefix << " " << setw(2) << (idx + 1) << ") " << CAT_NAME[idx];
-        string prefix_str = line_prefix.str();
-        int visual_width = getVisualWidth(prefix_str);
-        int padding_needed = 28 - visual_width; if (padding_needed < 1) padding_needed = 1;
-        ostringstream final_line; final_line << prefix_str << string(padding_needed, ' ')
-            << "= " << scorePreviewLine(static_cast<Category>(idx), dice, sc);
-        writeAt(x, yrow++, final_line.str());
+        line.assign(assets.previewLabel[showHint ? 1 : 0][idx]);
+        appendf(line, "%d", scorePreviewLine(static_cast<Category>(idx), dice, sc));
+        if (showHint) {
+            const CategoryOdds& co = hint.categories[idx];
+            appendf(line, "%6.0f%%%6.1f", co.probability * 100, co.expected);
+        }
+        writeAt(x, yrow++, line);
         };
 
     for (int i = 0; i < static_cast<int>(Category::CATEGORY_COUNT); ++i) {
@@ -272,26 +533,34 @@ void redrawAll(int round, int p_idx, int rollsLeft, const Dice& dice, const arra
 
     //   Ŭ
     int rightWidth = max(1, getConsoleCols() - RIGHT_X - 1);
-    writeAt(RIGHT_X, message_y, string(rightWidth, ' '));
-    writeAt(RIGHT_X, prompt_y, string(rightWidth, ' '));
+    writeAt(RIGHT_X, message_y, blankCells(rightWidth));
+    writeAt(RIGHT_X, prompt_y, blankCells(rightWidth));
 
     if (!errorMsg.empty()) writeAt(RIGHT_X, message_y, errorMsg);
     else if (!statusMsg.empty()) writeAt(RIGHT_X, message_y, statusMsg);
 
     writeAt(RIGHT_X, prompt_y, promptMsg);
     gotoXY(RIGHT_X + getVisualWidth(promptMsg), prompt_y);
+
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - frameStart).count();
+    g_renderStats.frames++;
+    g_renderStats.totalMs += ms;
+    g_renderStats.maxMs = max(g_renderStats.maxMs, ms);
 }
 
 void animateRoll(Dice& dice, const array<bool, 5>& held) {
-    const int totalFrames = 20;
-    vector<vector<int>> sequences(5);
+    TRACE_SCOPE("ui.animateRoll", "ui");
+    constexpr int totalFrames = 20;
+    array<array<int, totalFrames>, 5> sequences{};
     Dice tempDice = dice;
-    for (int i = 0; i < 5; ++i) if (!held[i]) sequences[i] = generateDiceSequence(totalFrames, 4);
+    for (int i = 0; i < 5; ++i) if (!held[i]) generateDiceSequence(sequences[i].data(), totalFrames, 4);
 
     for (int frame = 0; frame < totalFrames; ++frame) {
+        AllocSpan frameSpan(allocFrameStats());
         for (int i = 0; i < 5; ++i) if (!held[i]) tempDice[i] = sequences[i][frame];
         int dice_start_y = (RIGHT_Y + 3) + 5;
         redrawDiceOnly(tempDice, held, dice_start_y);
+        TRACE_SCOPE("sleep.animationFrame", "sleep");
         this_thread::sleep_for(chrono::milliseconds(60));
     }
     for (int i = 0; i < 5; ++i) if (!held[i]) dice[i] = sequences[i].back();
@@ -323,4 +592,275 @@ void displayTopScores(GameDB& db) {
 
     writeAt(5, getConsoleRows() - 2, u8"ƹ Ű  ޴ ư...");
     cin.get();
+}
+
+int drawSimDashboard(const SimResult& r, int targetGames, int threads, const vector<string>& labels, bool firstFrame) {
+    TRACE_SCOPE("ui.simDashboard", "ui");
+    const int LINE_W = 100;
+    const size_t seats = labels.size();
+    if (firstFrame) clearScreen();
+    int y = 2;
+    // ٸ   ä   ڰ  ʰ Ѵ
+    auto put = [&](const string& line) {
+        string padded = line;
+        padded.append(blankCells(max(0, LINE_W - getVisualWidth(line))));
+        writeAt(5, y++, padded);
+    };
+    auto seatTag = [](size_t p) { return "AI" + to_string(p + 1); };
+    auto alignRight = [](string_view text, int cells) { return string(blankCells(max(0, cells - getVisualWidth(text)))).append(text); };
+
+    put(u8"==========   ==========");
+    y++;
+    ostringstream line;
+    line << fixed << setprecision(1) << u8" " << r.games << " / " << targetGames << u8" ("
+        << (targetGames ? 100.0 * r.games / targetGames : 0.0) << u8"%)   ʴ " << (r.seconds > 0 ? r.games / r.seconds : 0.0)
+        << u8"    " << r.seconds << u8"   Ŀ " << threads << u8"";
+    put(line.str());
+    const int BAR = 50;
+    const int filled = targetGames ? static_cast<int>(BAR * static_cast<double>(r.games) / targetGames) : 0;
+    put("[" + string(min(BAR, filled), '#') + string(BAR - min(BAR, filled), '.') + "]");
+    y++;
+
+    line.str("");
+    line << left << setw(6) << "" << fitName(u8"AI", 24) << alignRight(u8" ", 12) << alignRight(u8"·", 10);
+    put(line.str());
+    for (size_t p = 0; p < seats; ++p) {
+        line.str("");
+        line << left << setw(6) << seatTag(p) << fitName(labels[p], 24) << right << fixed << setprecision(1)
+            << setw(12) << (p < r.meanScore.size() ? r.meanScore[p] : 0.0)
+            << setw(9) << (p < r.winRate.size() ? 100.0 * r.winRate[p] : 0.0) << "%";
+        put(line.str());
+    }
+    y++;
+
+    // ĭ ä :    ڸ ٿ Ѵ ̰ Ѵ
+    static const char SHADE[] = " .:-=+*#%@";
+    put(u8"ĭ ä  (0 ƴ    )");
+    line.str("");
+    line << fitName("", 18);
+    for (size_t p = 0; p < seats; ++p) line << right << setw(7) << seatTag(p) << "  ";
+    put(line.str());
+    for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) {
+        const Category cat = static_cast<Category>(c);
+        line.str("");
+        line << fitName(string(categoryName(cat)), 18);
+        for (size_t p = 0; p < seats; ++p) {
+            if (!categoryActive(cat) || p >= r.fillRate.size()) { line << setw(7) << "-" << "  "; continue; }
+            const double rate = r.fillRate[p][c];
+            line << setw(6) << static_cast<int>(rate * 100 + 0.5) << "% " << SHADE[min(9, static_cast<int>(rate * 10))];
+        }
+        put(line.str());
+    }
+    y++;
+
+    put(u8"  ( AI   AI     ,  )");
+    line.str("");
+    line << setw(6) << "";
+    for (size_t b = 0; b < seats; ++b) line << setw(8) << seatTag(b);
+    put(line.str());
+    for (size_t a = 0; a < seats; ++a) {
+        line.str("");
+        line << left << setw(6) << seatTag(a) << right;
+        for (size_t b = 0; b < seats; ++b) {
+            if (a == b || a * seats + b >= r.headToHead.size()) line << setw(8) << "-";
+            else line << setw(7) << fixed << setprecision(1) << 100.0 * r.headToHead[a * seats + b] << "%";
+        }
+        put(line.str());
+    }
+    cout.flush();
+    return y + 1;
+}
+
+// ÷   ó replayTo   ǿ ݿ
+static void rebuildScorecards(const ReplayGame& game, const vector<ReplayTurn>& turns, int uptoRound, vector<Scorecard>& players) {
+    players.clear();
+    for (const auto& n : game.names) players.emplace_back(n);
+    for (const auto& t : turns) {
+        if (t.round >= uptoRound) break;
+        Scorecard& sc = players[t.player];
+        sc.setScore(t.category, t.score);
+        if (t.yahtzeeBonus) sc.yahtzeeBonusCount++;
+    }
+}
+
+void displayReplays() {
+    clearScreen();
+    writeAt(5, 2, u8"========== ÷ ==========");
+
+    ReplayWriter::instance().flush();   //   ӱ Ͽ ݿ
+    deque<ReplayGame> recent;
+    {
+        ReplayReader reader;
+        ReplayGame game;
+        if (reader.open(REPLAY_FILE)) {
+            while (reader.next(game)) {
+                recent.push_back(game);
+                if (recent.size() > 10) recent.pop_front();
+            }
+        }
+    }
+    if (recent.empty()) {
+        writeAt(5, 4, u8" ϵ  ϴ.");
+        writeAt(5, getConsoleRows() - 2, u8"ƹ Ű  ޴ ư...");
+        cin.get();
+        return;
+    }
+
+    int y = 4;
+    for (size_t i = 0; i < recent.size(); ++i) {
+        const ReplayGame& g = recent[i];
+        ostringstream line;
+        line << " " << setw(2) << i + 1 << ". ";
+        for (int p = 0; p < g.header.playerCount; ++p) {
+            if (p) line << ", ";
+            line << fitName(g.names[p], 10) << " " << g.header.totals[p];
+        }
+        writeAt(5, y++, line.str());
+    }
+    writeAt(5, y + 1, u8"  ȣ Էϼ (0: ư): ");
+    int choice = -1;
+    while (!(cin >> choice) || choice < 0 || choice > static_cast<int>(recent.size())) {
+        cin.clear(); cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+        writeAt(5, y + 2, string(40, ' '));
+        writeAt(5, y + 2, u8"ùٸ ȣ Էϼ: ");
+    }
+    cin.ignore((numeric_limits<streamsize>::max)(), '\n');
+    if (choice == 0) return;
+
+    const ReplayGame& game = recent[choice - 1];
+    // ϵ Ģ  ְ,    Ģ ǵ
+    struct RulesRestore {
+        RulesVariant prev = rulesVariant();
+        ~RulesRestore() { setRulesVariant(prev); }
+    } rulesRestore;
+    setRulesVariant(replayRules(game.header));
+    const int rounds = activeCategoryCount();
+    vector<ReplayTurn> turns;
+    if (!ReplayReader::decodeTurns(game, 1, turns)) {
+        writeAt(5, y + 3, u8"÷  ջǾϴ.");
+        cin.get();
+        return;
+    }
+
+    vector<Scorecard> players;
+    rebuildScorecards(game, turns, 1, players);
+    const string prompt = u8"Enter: , : ش  ̵, q: ";
+    string status;
+    size_t t = 0;
+    while (t < turns.size()) {
+        const ReplayTurn& tr = turns[t];
+        int jumpTo = 0;
+        for (int r = 0; r < tr.rollCount && !jumpTo; ++r) {
+            array<bool, 5> held{};
+            if (r + 1 < tr.rollCount)   //     Ȧ =    ũ
+                for (int i = 0; i < 5; ++i) held[i] = (tr.heldBefore[r + 1] >> i) & 1;
+            redrawAll(tr.round, tr.player, 3 - (r + 1), tr.dice[r], held, players, prompt, "", status);
+            string input; getline(cin, input);
+            if (input == "q" || input == "Q") return;
+            if (!input.empty()) {
+                int n = atoi(input.c_str());
+                jumpTo = (n >= 1 && n <= rounds) ? n : 0;
+                if (!jumpTo) status = u8"1~" + to_string(rounds) + u8"  带 Էϼ.";
+            }
+        }
+        if (jumpTo) {
+            rebuildScorecards(game, turns, jumpTo, players);
+            t = 0;
+            while (t < turns.size() && turns[t].round < jumpTo) ++t;
+            status = to_string(jumpTo) + u8" ̵߽ϴ.";
+            continue;
+        }
+
+        Scorecard& sc = players[tr.player];
+        sc.setScore(tr.category, tr.score);
+        if (tr.yahtzeeBonus) sc.yahtzeeBonusCount++;
+        status = sc.name + u8": " + string(categoryName(tr.category)) + u8" " + to_string(tr.score) + u8"";
+        ++t;
+    }
+
+    clearScreen();
+    writeAt(5, 2, u8"========== ÷  ==========");
+    y = 4;
+    for (const auto& pl : players) writeAt(5, y++, fitName(pl.name, 15) + " : " + to_string(pl.total()) + u8"");
+    writeAt(5, y + 2, u8"ƹ Ű  ޴ ư...");
+    cin.get();
+}
+
+// =================== ġũ ===================
+namespace {
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+}
+
+// ĳ    :  ASCII   ̿   2ĭ
+static int legacyVisualWidth(string_view s) {
+    int width = 0;
+    for (size_t i = 0; i < s.length(); ) {
+        unsigned char ch = s[i];
+        if (ch < 0x80) { width++; i++; }
+        else {
+            width += 2;
+            if ((ch & 0xE0) == 0xC0) i += 2;
+            else if ((ch & 0xF0) == 0xE0) i += 3;
+            else i++;
+        }
+    }
+    return width;
+}
+
+void runRenderBenchmark(int frames) {
+    if (frames < 10) frames = 10;
+    const string_view samples[] = {
+        "[T]oggle, [R]eroll, [S]core, [H]int: ",
+        u8" īװ ȣ Էϼ: ",
+        u8" 12)  ƮƮ",
+        u8"Player_ѱ̸",
+        u8"",
+        u8"caf\u00E9",                      // ҽ  CP949  ̽
+    };
+    const int passes = 200000;
+    long long checksum = 0;
+    auto nsPerCall = [&](auto&& fn) {
+        auto t0 = chrono::steady_clock::now();
+        for (int p = 0; p < passes; ++p)
+            for (string_view s : samples) checksum += fn(s);
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count() / (static_cast<double>(passes) * size(samples));
+    };
+    const double legacyNs = nsPerCall(legacyVisualWidth);
+    const double widthNs = nsPerCall(getVisualWidth);
+
+    // ȭ ׸: ͹̳   ۷ (Windows  ܼ API   ׸)
+    vector<Scorecard> players{ Scorecard(u8"÷̾1"), Scorecard(u8"ǻ1") };
+    players[0].setScore(Category::THREE_KIND, 12);
+    Dice dice{ 2, 3, 4, 4, 6 };
+    array<bool, 5> held{ false, true, true, false, false };
+#ifdef _WIN32
+    HOUT = GetStdHandle(STD_OUTPUT_HANDLE);
+#endif
+    NullBuffer sink;
+    streambuf* old = cout.rdbuf(&sink);
+    RenderStats plain, hinted;
+    for (int hint = 0; hint < 2; ++hint) {
+        setHintPanel(hint != 0);
+        resetRenderStats();
+        for (int i = 0; i < frames; ++i)
+            redrawAll(1 + i % 13, i & 1, 1 + i % 2, dice, held, players, u8" īװ ȣ Էϼ: ", "", u8"ֻ ϴ...");
+        (hint ? hinted : plain) = renderStats();
+    }
+    setHintPanel(false);
+    cout.rdbuf(old);
+#ifdef _WIN32
+    clearScreen();
+#endif
+
+    cout << fixed << setprecision(1)
+        << u8"ǥ  1ȸ:  " << legacyNs << u8" ns, East Asian Width ǥ " << widthNs << " ns  (checksum " << checksum << ")" << endl;
+    cout << u8"  \"\"  " << legacyVisualWidth(u8"") << u8"ĭ -> " << getVisualWidth(u8"")
+        << u8"ĭ, \"caf\u00E9\"  " << legacyVisualWidth(samples[5]) << u8"ĭ -> " << getVisualWidth(samples[5]) << u8"ĭ" << endl;
+    cout << setprecision(3)
+        << u8"redrawAll " << frames << u8" (ȭ  ): Ʈ   " << plain.totalMs / plain.frames << " ms / ִ " << plain.maxMs
+        << u8" ms, Ʈ   " << hinted.totalMs / hinted.frames << " ms / ִ " << hinted.maxMs << " ms" << endl;
 }
\ No newline at end of file
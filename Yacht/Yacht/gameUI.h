@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <array>
 #include <sstream>
@@ -33,7 +34,7 @@ extern const int RIGHT_Y;
 extern HANDLE HOUT;
 void hideCursor(bool hide);
 void gotoXY(int x, int y);
-void writeAt(int x, int y, const string& s);
+void writeAt(int x, int y, string_view s);
 void ensureConsoleSize(int cols, int rows);
 void clearScreen();
 int getConsoleCols();
@@ -41,7 +42,7 @@ int getConsoleRows();
 #else
 void hideCursor(bool hide);
 void gotoXY(int x, int y);
-void writeAt(int x, int y, const string& s);
+void writeAt(int x, int y, string_view s);
 void ensureConsoleSize(int, int);
 void clearScreen();
 int getConsoleCols();
@@ -49,18 +50,55 @@ int getConsoleRows();
 #endif
 
 // ƿƼ   Լ
-int getVisualWidth(const string& s);
+int getVisualWidth(string_view s);                              // ȭ ĭ  (ASCII   + East Asian Width ǥ)
+int codepointWidth(char32_t cp);
+void setAmbiguousWidth(int cells);                              // ȣ  ( ׸ ) ĭ  1 Ǵ 2
 string fitName(const string& s, int maxCells = 10);
+void appendFitName(string& out, string_view s, int maxCells);   // fitName   out   (Ҵ )
+string_view blankCells(int width);                              //  width ĭ (̸   Ϻ)
 void drawVerticalSep(int col, int y_top, int y_bottom, const string& glyph = u8"");
 void drawHRule(int x, int y);
 void clearRightPaneFrom(int start_y);
-vector<string> renderDie(int v, bool held);
+using DieArt = array<string, 5>;
+const DieArt& renderDie(int v, bool held);                      // ̸  ׸ 
+
+//  ڻ ĳ: Ģ ó      縸 Ѵ
+struct RenderAssets {
+    array<string, static_cast<size_t>(Category::CATEGORY_COUNT)> scoreLabel;               // " 1) ̽" +   + ": "
+    array<array<string, static_cast<size_t>(Category::CATEGORY_COUNT)>, 2> previewLabel;   // [Ʈ ] " 1) ̽" +   + "= "
+    string subtotalLabel, bonusLabel;                                                       //   + ": "  (ʽ  Ģ å)
+    int upperBonusThreshold = 0;
+    string yahtzeeBonusPrefix;
+    int yahtzeeBonusPrefixWidth = 0;
+    array<array<DieArt, 2>, 7> dice;                                                        // [ 0~6][Ȧ]
+};
+const RenderAssets& renderAssets(RulesVariant v);
+const RenderAssets& renderAssets();                             //  Ģ
+
+// redrawAll      ð (ȭ  )
+struct RenderStats {
+    uint64_t frames = 0;
+    double totalMs = 0;
+    double maxMs = 0;
+};
+const RenderStats& renderStats();
+void resetRenderStats();
 int scorePreviewLine(Category i, const Dice& d, const Scorecard& sc);
 
 //   Լ
-void redrawAll(int round, int p_idx, int rollsLeft, const Dice& dice, const array<bool, 5>& held, const vector<Scorecard>& players, const string& promptMsg, const string& errorMsg = "", const string& statusMsg = "");
+void setHintPanel(bool visible);     // Ȯ/밪 Ʈ г ( ʿ )
+bool hintPanelVisible();
+void redrawAll(int round, int p_idx, int rollsLeft, const Dice& dice, const array<bool, 5>& held, const vector<Scorecard>& players, string_view promptMsg, string_view errorMsg = "", string_view statusMsg = "");
 void redrawDiceOnly(const Dice& dice, const array<bool, 5>& held, int start_y);
-void displayImpactEffect(const string& combinationName);
+void displayImpactEffect(string_view combinationName);
 void animateRoll(Dice& dice, const array<bool, 5>& held);
 void displayTopScores(GameDB& db);
+void displayReplays();
+
+//   ú ( Ȳ, ¼ /·, ĭ ä ,  ). ȭ ó      
+struct SimResult;
+int drawSimDashboard(const SimResult& r, int targetGames, int threads, const vector<string>& labels, bool firstFrame);   //    y ȯ
+
+// ǥ   ӵ redrawAll  ð  ( --bench-render)
+void runRenderBenchmark(int frames);
 #endif // GAMEUI_H
\ No newline at end of file
@@ -0,0 +1,364 @@
+#include "gameWinProb.h"
+#include "gameAI.h"
+#include "gameOdds.h"
+#include "gameReroll.h"
+#include "gameRules.h"
+#include "gameSim.h"
+#include "gameTrace.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+using namespace dicetab;
+
+constexpr int WP_MAX_CAT_SCORE = 50;    // ĭ ϳ ְ ( Ģ  Ʈ 50)
+constexpr int WP_BINS = 1024;           //    ũ (1 , ġ   ĭ)
+
+// =================== ĭ   (Ģ  ) ===================
+// p[s] =  ĭ 븮     s  Ȯ x 65535. ĭ 102Ʈ, 13ĭ 1.3 KB
+struct CategoryHistogram {
+    array<uint16_t, WP_MAX_CAT_SCORE + 1> p{};
+};
+struct WinProbTables {
+    array<CategoryHistogram, CAT_N> cat;
+    array<array<double, WP_MAX_CAT_SCORE + 1>, CAT_N> pmf{};    // ȭ   1  ٽ  
+    array<int, CAT_N> len{};                                    // 0  ƴ   + 1
+};
+
+//  " ĭ  " ִ keep       Ѵ
+template <class R>
+static WinProbTables buildWinProbTables() {
+    static_assert(R::DICE == 5 && R::FACES == 6, "REROLL_MATRIX  ֻ 5, 6 ");
+    const auto& scores = rules::HAND_TABLE<R>.scores;
+    const RerollMatrix& mx = REROLL_MATRIX;
+    WinProbTables t;
+    vector<double> v0(HAND_COUNT), v1(HAND_COUNT), v2(HAND_COUNT), w1(KEEP_COUNT), w2(KEEP_COUNT);
+    vector<double> d1(HAND_COUNT), d2(HAND_COUNT), d3(HAND_COUNT);
+    vector<uint16_t> keepLast(HAND_COUNT), keepFirst(HAND_COUNT);
+    for (int c = 0; c < CAT_N; ++c) {
+        double pmf[WP_MAX_CAT_SCORE + 1] = {};
+        if (!rules::Kernel<R>::active(static_cast<Category>(c))) {
+            pmf[0] = 1;
+        }
+        else {
+            for (int h = 0; h < HAND_COUNT; ++h) v0[h] = scores[h][c];
+            mx.expect(v0.data(), w1.data());
+            RerollMatrix::bestKeep(w1.data(), v1.data(), keepLast.data());     //   
+            mx.expect(v1.data(), w2.data());
+            RerollMatrix::bestKeep(w2.data(), v2.data(), keepFirst.data());    // ù  
+
+            fill(d1.begin(), d1.end(), 0.0);
+            fill(d2.begin(), d2.end(), 0.0);
+            fill(d3.begin(), d3.end(), 0.0);
+            for (int i = mx.rowBegin(0); i < mx.rowEnd(0); ++i) d1[mx.outcome(i)] += mx.probability(i);
+            for (int h = 0; h < HAND_COUNT; ++h)
+                for (int i = mx.rowBegin(keepFirst[h]); i < mx.rowEnd(keepFirst[h]); ++i) d2[mx.outcome(i)] += d1[h] * mx.probability(i);
+            for (int h = 0; h < HAND_COUNT; ++h)
+                for (int i = mx.rowBegin(keepLast[h]); i < mx.rowEnd(keepLast[h]); ++i) d3[mx.outcome(i)] += d2[h] * mx.probability(i);
+            for (int h = 0; h < HAND_COUNT; ++h) pmf[scores[h][c]] += d3[h];
+        }
+        double sum = 0;
+        for (int s = 0; s <= WP_MAX_CAT_SCORE; ++s) {
+            t.cat[c].p[s] = static_cast<uint16_t>(pmf[s] * 65535 + 0.5);
+            sum += t.cat[c].p[s];
+        }
+        for (int s = 0; s <= WP_MAX_CAT_SCORE; ++s) {
+            t.pmf[c][s] = t.cat[c].p[s] / sum;
+            if (t.cat[c].p[s]) t.len[c] = s + 1;
+        }
+    }
+    return t;
+}
+
+template <class R>
+static const WinProbTables& winProbTables() {
+    static const WinProbTables tables = buildWinProbTables<R>();
+    return tables;
+}
+
+// ===================  ռ ===================
+//  Ҵ ʵ 庰  ۸ 
+struct Dist {
+    int n = 1;
+    double p[WP_BINS];
+    void unit() { n = 1; p[0] = 1; }
+};
+
+static void convolveInto(Dist& d, const double* b, int nb) {
+    static thread_local double tmp[WP_BINS];
+    const int n = (std::min)(d.n + nb - 1, WP_BINS);
+    fill(tmp, tmp + n, 0.0);
+    for (int i = 0; i < d.n; ++i) {
+        if (d.p[i] == 0) continue;
+        for (int j = 0; j < nb; ++j) tmp[(std::min)(i + j, WP_BINS - 1)] += d.p[i] * b[j];
+    }
+    copy(tmp, tmp + n, d.p);
+    d.n = n;
+}
+
+static bool isUpper(int c) { return c <= static_cast<int>(Category::SIXES); }
+
+//  ĭ(skip )    Ʒ  
+static void openParts(const Scorecard& sc, int skip, const WinProbTables& t, Dist& upper, Dist& lower) {
+    upper.unit();
+    lower.unit();
+    for (int c = 0; c < CAT_N; ++c) {
+        if (sc.used[c] || c == skip) continue;
+        convolveInto(isUpper(c) ? upper : lower, t.pmf[c].data(), t.len[c]);
+    }
+}
+
+// ϵ ( ʽ ) +  .  ʽ    
+template <class R>
+static void finalDistribution(const Scorecard& sc, const WinProbTables& t, Dist& out) {
+    static thread_local Dist upper, lower;
+    openParts(sc, -1, t, upper, lower);
+    const int fixed = sc.upperSum() + sc.lowerSum() + sc.yahtzeeBonusCount * YAHTZEE_BONUS_SCORE;
+    const int curUpper = sc.upperSum();
+    out.n = (std::min)(fixed + upper.n + R::UPPER_BONUS + lower.n, WP_BINS);
+    fill(out.p, out.p + out.n, 0.0);
+    for (int u = 0; u < upper.n; ++u) {
+        if (upper.p[u] == 0) continue;
+        const int base = fixed + u + (curUpper + u >= R::UPPER_BONUS_THRESHOLD) * R::UPPER_BONUS;
+        for (int l = 0; l < lower.n; ++l) out.p[(std::min)(base + l, WP_BINS - 1)] += upper.p[u] * lower.p[l];
+    }
+}
+
+// beat[x] =   x   θ ̱ Ȯ ( )
+//  = (prod P(o < x) + prod P(o <= x)) / 2  (밡  ̸ Ȯ P(<) + P(=)/2)
+template <class R>
+static void beatTable(const Scorecard& self, const vector<Scorecard>& table, const WinProbTables& t, double* beat) {
+    static thread_local Dist opp;
+    static thread_local double below[WP_BINS], atMost[WP_BINS];
+    fill(below, below + WP_BINS, 1.0);
+    fill(atMost, atMost + WP_BINS, 1.0);
+    for (const Scorecard& o : table) {
+        if (&o == &self) continue;
+        finalDistribution<R>(o, t, opp);
+        double cdf = 0;
+        for (int x = 0; x < WP_BINS; ++x) {
+            const double p = x < opp.n ? opp.p[x] : 0.0;
+            below[x] *= cdf;
+            cdf += p;
+            atMost[x] *= cdf;
+        }
+    }
+    for (int x = 0; x < WP_BINS; ++x) beat[x] = 0.5 * (below[x] + atMost[x]);
+}
+
+//  ĭ c  s  (extra ŭ Ʈ ʽ Բ)   1 Ȯ ǥ wp[c][s]
+struct WinProbByScore {
+    array<array<double, WP_MAX_CAT_SCORE + 1>, CAT_N> wp;
+    array<bool, CAT_N> open{};
+};
+
+template <class R>
+static void winProbByScore(const Scorecard& self, const vector<Scorecard>& table, const WinProbTables& t, int extra, WinProbByScore& out) {
+    static thread_local double beat[WP_BINS], reach[WP_BINS];
+    static thread_local Dist upper, lower;
+    beatTable<R>(self, table, t, beat);
+    const int fixed = self.upperSum() + self.lowerSum() + (self.yahtzeeBonusCount + extra) * YAHTZEE_BONUS_SCORE;
+    const int curUpper = self.upperSum();
+    for (int c = 0; c < CAT_N; ++c) {
+        out.open[c] = !self.used[c];
+        if (!out.open[c]) continue;
+        openParts(self, c, t, upper, lower);
+        // reach[v] = Ʒ   v   1 Ȯ = sum_l lower(l) * beat[v + l]
+        const int lo = fixed, hi = (std::min)(fixed + WP_MAX_CAT_SCORE + upper.n + R::UPPER_BONUS, WP_BINS);
+        for (int v = lo; v < hi; ++v) {
+            double s = 0;
+            for (int l = 0; l < lower.n; ++l) s += lower.p[l] * beat[(std::min)(v + l, WP_BINS - 1)];
+            reach[v] = s;
+        }
+        const int cu = isUpper(c);
+        for (int s = 0; s <= WP_MAX_CAT_SCORE; ++s) {
+            double w = 0;
+            for (int u = 0; u < upper.n; ++u) {
+                const int bonus = (curUpper + cu * s + u >= R::UPPER_BONUS_THRESHOLD) * R::UPPER_BONUS;
+                w += upper.p[u] * reach[(std::min)(fixed + s + u + bonus, hi - 1)];
+            }
+            out.wp[c][s] = w;
+        }
+    }
+}
+
+// ===================  ĭ   ===================
+template <class R>
+static FutureScoreTable buildFutureScoreTable() {
+    const WinProbTables& t = winProbTables<R>();
+    FutureScoreTable f;
+    f.bonus = R::UPPER_BONUS;
+    for (int c = 0; c < CAT_N; ++c)
+        for (int s = 0; s < t.len[c]; ++s) f.mean[c] += s * t.pmf[c][s];
+    Dist upper;
+    for (int open = 0; open < 64; ++open) {
+        upper.unit();
+        for (int c = 0; c < 6; ++c) if (open >> c & 1) convolveInto(upper, t.pmf[c].data(), t.len[c]);
+        for (int cur = 0; cur < 64; ++cur) {
+            double p = 0;
+            for (int u = 0; u < upper.n; ++u) if (cur + u >= R::UPPER_BONUS_THRESHOLD) p += upper.p[u];
+            f.bonusProb[open][cur] = static_cast<float>((std::min)(p, 1.0));
+        }
+    }
+    return f;
+}
+
+template <class R>
+static const FutureScoreTable& futureScoreTableFor() {
+    static const FutureScoreTable table = buildFutureScoreTable<R>();
+    return table;
+}
+
+const FutureScoreTable& futureScoreTable(RulesVariant v) {
+    return *rules::withRules(v, [](auto r) { return &futureScoreTableFor<decltype(r)>(); });
+}
+
+// ===================  ===================
+static atomic<uint64_t> g_wpDecisions{ 0 }, g_wpTotalNs{ 0 }, g_wpMaxNs{ 0 };
+
+static void recordDecision(chrono::steady_clock::time_point t0) {
+    const uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+    g_wpDecisions.fetch_add(1, memory_order_relaxed);
+    g_wpTotalNs.fetch_add(ns, memory_order_relaxed);
+    uint64_t prev = g_wpMaxNs.load(memory_order_relaxed);
+    while (ns > prev && !g_wpMaxNs.compare_exchange_weak(prev, ns, memory_order_relaxed)) {}
+}
+
+WinProbStats winProbStats() {
+    WinProbStats st;
+    st.decisions = g_wpDecisions.load(memory_order_relaxed);
+    st.totalNs = g_wpTotalNs.load(memory_order_relaxed);
+    st.maxNs = g_wpMaxNs.load(memory_order_relaxed);
+    return st;
+}
+void resetWinProbStats() {
+    g_wpDecisions.store(0, memory_order_relaxed);
+    g_wpTotalNs.store(0, memory_order_relaxed);
+    g_wpMaxNs.store(0, memory_order_relaxed);
+}
+
+bool winProbApplies(const Scorecard& self, const vector<Scorecard>& table) {
+    int open = 0;
+    for (int c = 0; c < CAT_N; ++c) open += !self.used[c];
+    return table.size() > 1 && open <= WINPROB_LATE_OPEN;
+}
+
+template <class R>
+static array<bool, 5> chooseHoldImpl(const Dice& d, const Scorecard& self, const vector<Scorecard>& table, int rollsLeft) {
+    const auto& scores = rules::HAND_TABLE<R>.scores;
+    static thread_local WinProbByScore wp;
+    static thread_local double v0[HAND_COUNT], v1[HAND_COUNT], w1[KEEP_COUNT];
+    winProbByScore<R>(self, table, winProbTables<R>(), 0, wp);
+
+    //     =  ĭ  1 Ȯ   ĭ   1 Ȯ
+    for (int h = 0; h < HAND_COUNT; ++h) {
+        double best = 0;
+        for (int c = 0; c < CAT_N; ++c) if (wp.open[c]) best = (std::max)(best, wp.wp[c][scores[h][c]]);
+        v0[h] = best;
+    }
+    const RerollMatrix& mx = REROLL_MATRIX;
+    const int level = (std::min)(rollsLeft, 2) - 1;
+    mx.expect(v0, w1);
+    if (level == 1) RerollMatrix::bestKeep(w1, v1);
+    auto keepValue = [&](int k) { return level == 0 ? w1[k] : mx.expect(k, v1); };
+
+    const int hand = handOf(d);
+    const uint16_t* subKeeps = SUBKEEPS.keeps[hand].data();
+    int bestKeep = subKeeps[0];
+    double bestValue = -1;
+    for (int i = 0; i < SUBKEEPS.count[hand]; ++i) {
+        double v = keepValue(subKeeps[i]);
+        if (v > bestValue + 1e-12) { bestValue = v; bestKeep = subKeeps[i]; }
+    }
+    return holdMaskFor(d, KEEP_FACES[bestKeep]);
+}
+
+template <class R>
+static Category chooseCategoryImpl(const Dice& d, const Scorecard& self, const vector<Scorecard>& table) {
+    static thread_local WinProbByScore wp;
+    const bool bonus = R::YACHT_BONUS_AND_JOKER && isYahtzee(d) && self.used[static_cast<int>(Category::YAHTZEE)] && self.scores[static_cast<int>(Category::YAHTZEE)] > 0;
+    winProbByScore<R>(self, table, winProbTables<R>(), bonus ? 1 : 0, wp);
+    Category best = Category::CATEGORY_COUNT;
+    double bestValue = -1;
+    for (int c = 0; c < CAT_N; ++c) {
+        if (!wp.open[c]) continue;
+        const int s = (std::min)(scoreWithJoker(static_cast<Category>(c), d, self), WP_MAX_CAT_SCORE);
+        // ·  (̹ Ȯ )   
+        const double v = wp.wp[c][s] + s * 1e-9;
+        if (v > bestValue) { bestValue = v; best = static_cast<Category>(c); }
+    }
+    return best;
+}
+
+array<bool, 5> chooseHold_WinProb(const Dice& d, const Scorecard& self, const vector<Scorecard>& table, int rollsLeft) {
+    TRACE_SCOPE("ai.winProbHold", "ai");
+    if (rollsLeft <= 0) return { true, true, true, true, true };
+    auto t0 = chrono::steady_clock::now();
+    array<bool, 5> held = rules::withRules(rulesVariant(), [&](auto r) { return chooseHoldImpl<decltype(r)>(d, self, table, rollsLeft); });
+    recordDecision(t0);
+    return held;
+}
+
+Category chooseCategory_WinProb(const Dice& d, const Scorecard& self, const vector<Scorecard>& table) {
+    TRACE_SCOPE("ai.winProbCategory", "ai");
+    auto t0 = chrono::steady_clock::now();
+    Category cat = rules::withRules(rulesVariant(), [&](auto r) { return chooseCategoryImpl<decltype(r)>(d, self, table); });
+    recordDecision(t0);
+    return cat;
+}
+
+double winProbability(const Dice& d, Category c, const Scorecard& self, const vector<Scorecard>& table) {
+    return rules::withRules(rulesVariant(), [&](auto r) {
+        using R = decltype(r);
+        static thread_local WinProbByScore wp;
+        winProbByScore<R>(self, table, winProbTables<R>(), 0, wp);
+        const int s = (std::min)(scoreWithJoker(c, d, self), WP_MAX_CAT_SCORE);
+        return wp.open[static_cast<int>(c)] ? wp.wp[static_cast<int>(c)][s] : 0.0;
+    });
+}
+
+// =================== ü  ===================
+void runWinProbBenchmark(int games, int threads) {
+    if (games < 2) games = 2;
+    if (threads < 1) threads = 1;
+    auto tb = chrono::steady_clock::now();
+    rules::withRules(rulesVariant(), [](auto r) { winProbTables<decltype(r)>(); });
+    cout << fixed << setprecision(2) << u8"ĭ   : "
+        << chrono::duration<double, milli>(chrono::steady_clock::now() - tb).count() << " ms ("
+        << sizeof(CategoryHistogram) * CAT_N << u8" Ʈ)" << endl;
+
+    // ڸ  Ҹ ַ ¼ ٲ ݾ д
+    auto match = [&](AIDifficulty a, AIDifficulty b, int seats) {
+        double win = 0, score = 0;
+        uint64_t played = 0;
+        double seconds = 0;
+        for (int order = 0; order < 2; ++order) {
+            SimConfig cfg;
+            cfg.games = games / 2;
+            cfg.threads = threads;
+            cfg.seed = 1000 + order;
+            cfg.seats.assign(seats, b);
+            cfg.seats[order == 0 ? 0 : seats - 1] = a;
+            SimResult r = runSimulation(cfg);
+            const int me = order == 0 ? 0 : seats - 1;
+            win += r.winRate[me] * r.games;
+            score += r.meanScore[me] * r.games;
+            played += r.games;
+            seconds += r.seconds;
+        }
+        cout << setw(30) << left << (string(seats == 2 ? u8"1:1 " : u8"1:2 ") + (a == AIDifficulty::WINPROB ? u8"· AI" : u8" AI")) << right
+            << setprecision(1) << setw(10) << 100.0 * win / played << "%" << setw(12) << score / played
+            << setw(10) << played / seconds << endl;
+    };
+    cout << setw(30) << left << u8" (  )" << right << setw(11) << u8"·" << setw(16) << u8" " << setw(10) << "games/s" << endl;
+    resetWinProbStats();
+    for (int seats : { 2, 3 }) {
+        match(AIDifficulty::HARD, AIDifficulty::HARD, seats);
+        match(AIDifficulty::WINPROB, AIDifficulty::HARD, seats);
+    }
+    WinProbStats st = winProbStats();
+    cout << setprecision(3) << u8"·  " << st.decisions << u8"ȸ:  " << (st.decisions ? st.totalNs / 1e6 / st.decisions : 0.0)
+        << u8" ms, ִ " << st.maxNs / 1e6 << " ms" << endl;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef GAMEWINPROB_H
+#define GAMEWINPROB_H
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include "gameLogic.h"
+
+using namespace std;
+
+// =================== · AI ===================
+// Ĺ( ĭ WINPROB_LATE_OPEN  )  Ǳ  "1  Ȯ" ִ Ȧ/ĭ .
+// ĭ ϳ  ( ĭ 븮 밪 ּ    ) Ģ    16Ʈ ȭ ΰ,
+//    ĭ  ռ  ÷̾     ( ʽ    Ȯ ݿ).
+// ĭ ̶  ٻ̸,   Ʈ ʽ(+100) Ŀ   ʴ´
+constexpr int WINPROB_LATE_OPEN = 6;
+
+//  ǿ ·   (Ĺ̰ 밡  )
+bool winProbApplies(const Scorecard& self, const vector<Scorecard>& table);
+
+// table = ڱ ڽ    (self  table  ҿ )
+array<bool, 5> chooseHold_WinProb(const Dice& d, const Scorecard& self, const vector<Scorecard>& table, int rollsLeft);
+Category chooseCategory_WinProb(const Dice& d, const Scorecard& self, const vector<Scorecard>& table);
+//  ֻ c    1 Ȯ (Ʈ/)
+double winProbability(const Dice& d, Category c, const Scorecard& self, const vector<Scorecard>& table);
+
+//  ĭ     밪 ٻ =  ĭ    +  ʽ Ȯ x ʽ (MCTS  򰡿).
+// ʽ Ȯ   ĭ (64)    ռ ̸  д
+struct FutureScoreTable {
+    array<double, static_cast<size_t>(Category::CATEGORY_COUNT)> mean{};
+    array<array<float, 64>, 64> bonusProb{};    // [  ĭ ũ][   (63 ̻ 63)]
+    int bonus = 0;
+
+    double operator()(uint16_t usedMask, int upperSum) const {
+        double v = 0;
+        for (int c = 0; c < static_cast<int>(Category::CATEGORY_COUNT); ++c) if (!(usedMask >> c & 1)) v += mean[c];
+        return v + bonus * bonusProb[~usedMask & 63][(std::min)(upperSum, 63)];
+    }
+};
+const FutureScoreTable& futureScoreTable(RulesVariant v);
+
+//  ð (//ִ, )
+struct WinProbStats {
+    uint64_t decisions = 0;
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+};
+WinProbStats winProbStats();
+void resetWinProbStats();
+
+//  AI  ü  ·  ð  ( --bench-winprob)
+void runWinProbBenchmark(int games, int threads);
+
+#endif // GAMEWINPROB_H
\ No newline at end of file
@@ -1,7 +1,185 @@
+#include "gameServer.h"
+#include "gameSpectate.h"
+#include "gameReplay.h"
+#include "gameCheckpoint.h"
+#include "gameSim.h"
+#include "gameOdds.h"
+#include "gameWinProb.h"
+#include "gameMcts.h"
+#include "gameEndgame.h"
+#include "gameBatch.h"
+#include "gameEnv.h"
+#include "gameBot.h"
+#include "gameReroll.h"
+#include "gameAlloc.h"
+#include "gameTrace.h"
 #include "gamePlay.h"
 #include "gameDB.h"
 
-int main() {
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+
+// ===================    ===================
+// ڰ ƴϰų [lo, hi] ̸  ϰ Ѵ (ܷ װų  ߸ ʰ)
+struct CliArgs {
+    const vector<string>& args;
+    const char* usage;
+
+    template <typename T>
+    T num(size_t i, T fallback, T lo, T hi) const {
+        if (i >= args.size()) return fallback;
+        const string& s = args[i];
+        errno = 0;
+        char* end = nullptr;
+        const long long v = strtoll(s.c_str(), &end, 10);
+        if (s.empty() || *end != '\0' || errno == ERANGE || v < static_cast<long long>(lo) || v > static_cast<long long>(hi)) {
+            std::cerr << u8"߸ : " << s << u8" (" << lo << u8"~" << hi << u8")" << std::endl;
+            std::cerr << u8": Yacht.exe " << usage << std::endl;
+            exit(2);
+        }
+        return static_cast<T>(v);
+    }
+};
+
+int main(int argc, char* argv[]) {
+    vector<string> args(argv + 1, argv + argc);
+    // --trace [.json]  ٸ ɼǰ Բ   ִ.   Chrome   
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (args[i] != "--trace") continue;
+        size_t n = 1;
+        string path = "trace.json";
+        if (i + 1 < args.size() && args[i + 1].size() > 5 && args[i + 1].compare(args[i + 1].size() - 5, 5, ".json") == 0) { path = args[i + 1]; n = 2; }
+        startTracing(path.c_str());
+        args.erase(args.begin() + i, args.begin() + i + n);
+        break;
+    }
+    // --bot < | ̺귯.dll/.so>  ٸ ɼǰ Բ   ִ. ̵ 6(ܺ )   ´
+    for (size_t i = 0; i + 1 < args.size(); ++i) {
+        if (args[i] != "--bot") continue;
+        setExternalBot(ExternalBot::open(args[i + 1], 200));
+        if (!externalBot()) std::cerr << u8"ܺ   ߽ϴ: " << args[i + 1] << std::endl;
+        args.erase(args.begin() + i, args.begin() + i + 2);
+        break;
+    }
+    if (!args.empty() && args[0] == "--bot-example") { // --bot-example (ǥ    )
+        return runExampleBot();
+    }
+    if (!args.empty() && args[0] == "--server") {
+        const CliArgs a{ args, u8"--server [Ʈ] [ ] [IO  ]" };
+        ServerConfig cfg;
+        cfg.port = a.num<uint16_t>(1, cfg.port, 0, 65535);
+        cfg.shards = a.num(2, cfg.shards, 1, 64);
+        cfg.ioThreads = a.num(3, cfg.ioThreads, 1, MAX_IO_THREADS);
+        return runServer(cfg);
+    }
+    if (!args.empty() && args[0] == "--bench-server") {
+        const CliArgs a{ args, u8"--bench-server [ִ  ] [ ] []" };
+        runServerBenchmark(a.num(1, (int)thread::hardware_concurrency() / 2, 1, 64), a.num(2, 256, 1, 100000), a.num(3, 3, 1, 3600));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--spectate") {
+        const CliArgs a{ args, u8"--spectate [ȣƮ] [Ʈ] [ ȣ]" };
+        run_spectator_client(args.size() > 1 ? args[1] : "127.0.0.1", a.num<uint16_t>(2, 7777, 1, 65535), a.num<uint32_t>(3, 1, 0, UINT32_MAX));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-spectate") {
+        const CliArgs a{ args, u8"--bench-spectate [ ] [  %] []" };
+        runSpectatorBenchmark(a.num(1, 2000, 1, 100000), a.num(2, 10, 0, 100), a.num(3, 5, 1, 3600));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-replay") {
+        const CliArgs a{ args, u8"--bench-replay [ ] [ ]" };
+        runReplayBenchmark(a.num(1, 2000, 1, 1000000), a.num(2, 50, 1, 10000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-checkpoint") {
+        const CliArgs a{ args, u8"--bench-checkpoint [ݺ Ƚ]" };
+        runCheckpointBenchmark(a.num(1, 2000, 1, 10000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-ai") {
+        const CliArgs a{ args, u8"--bench-ai [ ] [ ]" };
+        runAIBenchmark(a.num(1, 200, 1, 1000000), a.num(2, (int)thread::hardware_concurrency(), 1, 256));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-odds") {
+        const CliArgs a{ args, u8"--bench-odds [ݺ Ƚ]" };
+        runOddsBenchmark(a.num(1, 20000, 1, 100000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-tables") {
+        const CliArgs a{ args, u8"--bench-tables [ݺ Ƚ]" };
+        runTableBenchmark(a.num(1, 200, 1, 1000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-reroll") {
+        const CliArgs a{ args, u8"--bench-reroll [ݺ Ƚ]" };
+        runRerollBenchmark(a.num(1, 20000, 1, 100000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-rules") {
+        const CliArgs a{ args, u8"--bench-rules [ ]" };
+        runRulesBenchmark(a.num(1, 200, 1, 1000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-winprob") {
+        const CliArgs a{ args, u8"--bench-winprob [ ] [ ]" };
+        runWinProbBenchmark(a.num(1, 400, 1, 1000000), a.num(2, (int)thread::hardware_concurrency(), 1, 256));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-mcts") {
+        const CliArgs a{ args, u8"--bench-mcts [ ]" };
+        runMctsBenchmark(a.num(1, 100, 1, 100000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-endgame") {
+        const CliArgs a{ args, u8"--bench-endgame [ ] [ ]" };
+        runEndgameBenchmark(a.num(1, 200, 1, 1000000), a.num(2, (int)thread::hardware_concurrency(), 1, 256));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-scorecard") {
+        const CliArgs a{ args, u8"--bench-scorecard [ ]" };
+        runScorecardBenchmark(a.num(1, 10000, 1, 10000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-env") {
+        const CliArgs a{ args, u8"--bench-env [ִ ȯ ] [ũ⺰ ]" };
+        return runEnvBenchmark(a.num(1, 4096, 1, 1000000), a.num(2, 1, 1, 3600));
+    }
+    if (!args.empty() && args[0] == "--bench-bot") {
+        const CliArgs a{ args, u8"--bench-bot [ ]" };
+        runBotBenchmark(argv[0], a.num(1, 512, 1, 1000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-render") {
+        const CliArgs a{ args, u8"--bench-render [ ]" };
+        runRenderBenchmark(a.num(1, 2000, 1, 10000000));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--fast-forward") { // DB  
+        const CliArgs a{ args, u8"--fast-forward [ ] [̵ ȣ, : 123]" };
+        const string levels = args.size() > 2 ? args[2] : "123";
+        vector<string> names;
+        vector<AIDifficulty> seats;
+        for (char ch : levels) {
+            if (ch < '1' || ch > '6' || seats.size() == 5) continue;
+            seats.push_back(static_cast<AIDifficulty>(ch - '1'));
+            names.push_back(u8"ǻ" + to_string(seats.size()));
+        }
+        if (seats.size() < 2) { std::cerr << u8"̵ 2~5 ʿմϴ (: 123)" << std::endl; return 1; }
+        runFastForwardSpectator(nullptr, names, seats, a.num(1, 2000, 1, 100000000), (std::max)(1, (int)thread::hardware_concurrency()));
+        return 0;
+    }
+    if (!args.empty() && args[0] == "--bench-db") {
+        const CliArgs a{ args, u8"--bench-db [ִ Ŭ̾Ʈ ] [Ǯ ũ] [ܰ躰 ] [ȣƮ|local] [] [ȣ]" };
+        return runDBBenchmark(args.size() > 4 ? args[4] : "local", args.size() > 5 ? args[5] : "root", args.size() > 6 ? args[6] : "1111",
+            a.num(1, 64, 1, 4096), a.num(2, 8, 1, 1024), a.num(3, 3, 1, 3600));
+    }
+    if (!args.empty() && args[0] == "--check-alloc") { // --check-alloc (Debug Ǵ YACHT_ALLOC_TRACE )
+        return runAllocCheck();
+    }
+
     GameDB db("192.168.0.49", "root", "1111", "scoredb"); // DB ü    Է
     if (!db.connect()) {
         std::cerr << "DB  . α׷ մϴ." << std::endl;